@@ -75,6 +75,14 @@ if test "x$HAVE_CANTERA" = "x1"; then
 else
   echo '   'Cantera....................... : no
 fi
+if test "x$HAVE_HDF5" = "x1"; then
+  echo '   'HDF5.......................... : yes
+  echo '     'HDF5_CPPFLAGS............... : $HDF5_CPPFLAGS
+  echo '     'HDF5_LDFLAGS................ : $HDF5_LDFLAGS
+  echo '     'HDF5_LIBS................... : $HDF5_LIBS
+else
+  echo '   'HDF5.......................... : no
+fi
 if test "$HAVE_GRVY" = "0"; then
   echo '   'Link with GRVY................ : no
 else
@@ -26,6 +26,12 @@
 #ifndef GRINS_ASSEMBLY_CONTEXT_H
 #define GRINS_ASSEMBLY_CONTEXT_H
 
+// GRINS
+#include "grins/cached_values.h"
+#include "grins/scratch_workspace.h"
+#include "grins/physics_dispatch_table.h"
+#include "grins/field_evaluations.h"
+
 // libMesh
 #include "libmesh/fem_context.h"
 
@@ -38,8 +44,68 @@ namespace GRINS
     AssemblyContext( const libMesh::System& system );
     ~AssemblyContext();
 
+    //! CachedValues that persist for the lifetime of this context
+    /*! The MultiphysicsSystem clears (but does not deallocate) this cache
+        before each residual evaluation so that the storage is reused across
+        elements. */
+    CachedValues& get_cached_values()
+    { return _cached_values; }
+
+    //! Scratch memory for Physics that persists for the lifetime of this context
+    /*! Since each thread builds its own context, this is per-thread
+        and needs no locking. See ScratchWorkspace for usage. */
+    ScratchWorkspace& get_scratch()
+    { return _scratch; }
+
+    //! Quantities evaluated once per element for all Physics, see FieldEvaluations
+    const FieldEvaluations& get_field_evaluations() const
+    { return _field_evaluations; }
+
+    FieldEvaluations& get_field_evaluations()
+    { return _field_evaluations; }
+
+    //! Request var be included in get_field_evaluations().values()
+    /*! Meant to be called from Physics::init_context(). This also
+        prerequests the element shape functions needed. */
+    void request_field_values( VariableIndex var );
+
+    //! Request var be included in get_field_evaluations().gradients()
+    void request_field_gradients( VariableIndex var );
+
+    //! Request var be included in get_field_evaluations().hessians()
+    void request_field_hessians( VariableIndex var );
+
+    //! This context's copy of the MultiphysicsSystem dispatch table
+    PhysicsDispatchTable& get_dispatch_table()
+    { return _dispatch_table; }
+
+    //! Called by the Physics base class residual and cache functions
+    /*! Those functions do nothing, so this tells MultiphysicsSystem that
+        the Physics it just called can be dropped from the dispatch table. */
+    void flag_noop_hook() const
+    { _noop_hook_flagged = true; }
+
+    //! Clear the flag set by flag_noop_hook(), returning whether it was set
+    bool reset_noop_hook()
+    {
+      bool flagged = _noop_hook_flagged;
+      _noop_hook_flagged = false;
+      return flagged;
+    }
+
   protected:
 
+    CachedValues _cached_values;
+
+    ScratchWorkspace _scratch;
+
+    FieldEvaluations _field_evaluations;
+
+    PhysicsDispatchTable _dispatch_table;
+
+    //! Mutable so const contexts passed to cache functions can set it
+    mutable bool _noop_hook_flagged;
+
   };
 
 } // end namespace GRINS
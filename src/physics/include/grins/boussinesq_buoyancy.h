@@ -53,6 +53,9 @@ namespace GRINS
 
     ~BoussinesqBuoyancy();
 
+    //! Request the temperature values we need at the quadrature points
+    virtual void init_context( AssemblyContext& context );
+
     //! Source term contribution for BoussinesqBuoyancy
     /*! This is the main part of the class. This will add the source term to
         the IncompressibleNavierStokes class.
@@ -61,6 +64,10 @@ namespace GRINS
 					  AssemblyContext& context,
 					  CachedValues& cache );
 
+    //! Momentum source depends only on temperature
+    virtual void declare_variable_coupling( const libMesh::System& system,
+                                            libMesh::CouplingMatrix& coupling ) const;
+
   private:
 
     BoussinesqBuoyancy();
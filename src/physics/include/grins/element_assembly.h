@@ -0,0 +1,180 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_ELEMENT_ASSEMBLY_H
+#define GRINS_ELEMENT_ASSEMBLY_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/var_typedefs.h"
+#include "grins/dual_number.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_subvector.h"
+
+namespace GRINS
+{
+  // Forward declarations
+  class AssemblyContext;
+
+  //! Element interior solution access and residual accumulation for any scalar type
+  /*!
+    Physics that write their element residual once as a template on
+    Scalar, using an ElementAssembly<Scalar> for every solution dependent
+    quantity and add_residual() for every contribution, get two things:
+
+    - With Scalar = libMesh::Real, the residual exactly as FEMContext
+      would have assembled it.
+    - With Scalar = DualNumber, every solution, fixed solution and rate
+      degree of freedom on the element is seeded as an independent
+      variable, scaled by the context's elem_solution_derivative,
+      fixed_solution_derivative and elem_solution_rate_derivative
+      respectively. add_residual() then also adds the exact element
+      Jacobian of each contribution, in one pass and with no perturbation
+      size to choose.
+
+    Physics expose the DualNumber path to MultiphysicsSystem through
+    Physics::ad_residual(). Anything computed outside of ElementAssembly
+    (e.g. material properties evaluated from the AssemblyContext) is a
+    constant as far as the Jacobian is concerned.
+
+    Gradients and Hessians are returned as flat arrays of LIBMESH_DIM and
+    LIBMESH_DIM*LIBMESH_DIM (row major) entries respectively.
+   */
+  template<typename Scalar>
+  class ElementAssembly
+  {
+  public:
+
+    ElementAssembly( AssemblyContext& context );
+    ~ElementAssembly(){};
+
+    AssemblyContext& context()
+    { return _context; }
+
+    const AssemblyContext& context() const
+    { return _context; }
+
+    Scalar interior_value( VariableIndex var, unsigned int qp ) const;
+
+    void interior_gradient( VariableIndex var, unsigned int qp, Scalar* grad ) const;
+
+    void interior_hessian( VariableIndex var, unsigned int qp, Scalar* hess ) const;
+
+    Scalar fixed_interior_value( VariableIndex var, unsigned int qp ) const;
+
+    void fixed_interior_gradient( VariableIndex var, unsigned int qp, Scalar* grad ) const;
+
+    void fixed_interior_hessian( VariableIndex var, unsigned int qp, Scalar* hess ) const;
+
+    Scalar interior_rate( VariableIndex var, unsigned int qp ) const;
+
+    //! Add value to the element residual of var at local dof i
+    void add_residual( VariableIndex var, unsigned int i, const Scalar& value );
+
+  private:
+
+    //! Which element coefficients to contract the shape functions with
+    enum CoefficientType { SOLUTION, FIXED_SOLUTION, SOLUTION_RATE };
+
+    //! Element coefficients of var for type, and their derivative scaling in the Jacobian
+    const libMesh::DenseSubVector<libMesh::Number>& coefficients( CoefficientType type,
+                                                                  VariableIndex var,
+                                                                  libMesh::Real& derivative ) const;
+
+    Scalar value( CoefficientType type, VariableIndex var, unsigned int qp ) const;
+
+    void gradient( CoefficientType type, VariableIndex var, unsigned int qp, Scalar* grad ) const;
+
+    void hessian( CoefficientType type, VariableIndex var, unsigned int qp, Scalar* hess ) const;
+
+    //! \sum_j _weights[j]*coeffs(j), with the coefficients as independent variables if result is a DualNumber
+    void contract( CoefficientType type, VariableIndex var, libMesh::Real& result ) const;
+
+    void contract( CoefficientType type, VariableIndex var, DualNumber& result ) const;
+
+    void scatter( VariableIndex var, unsigned int i, const libMesh::Real& value );
+
+    void scatter( VariableIndex var, unsigned int i, const DualNumber& value );
+
+    AssemblyContext& _context;
+
+    //! Position of each variable's first dof in the element numbering
+    std::vector<unsigned int> _dof_offsets;
+
+    unsigned int _n_dofs;
+
+    //! Shape function values (or derivative components) at the current qp
+    mutable std::vector<libMesh::Real> _weights;
+
+    ElementAssembly();
+  };
+
+  template<typename Scalar>
+  inline
+  Scalar ElementAssembly<Scalar>::interior_value( VariableIndex var, unsigned int qp ) const
+  { return this->value( SOLUTION, var, qp ); }
+
+  template<typename Scalar>
+  inline
+  void ElementAssembly<Scalar>::interior_gradient( VariableIndex var, unsigned int qp, Scalar* grad ) const
+  { this->gradient( SOLUTION, var, qp, grad ); }
+
+  template<typename Scalar>
+  inline
+  void ElementAssembly<Scalar>::interior_hessian( VariableIndex var, unsigned int qp, Scalar* hess ) const
+  { this->hessian( SOLUTION, var, qp, hess ); }
+
+  template<typename Scalar>
+  inline
+  Scalar ElementAssembly<Scalar>::fixed_interior_value( VariableIndex var, unsigned int qp ) const
+  { return this->value( FIXED_SOLUTION, var, qp ); }
+
+  template<typename Scalar>
+  inline
+  void ElementAssembly<Scalar>::fixed_interior_gradient( VariableIndex var, unsigned int qp, Scalar* grad ) const
+  { this->gradient( FIXED_SOLUTION, var, qp, grad ); }
+
+  template<typename Scalar>
+  inline
+  void ElementAssembly<Scalar>::fixed_interior_hessian( VariableIndex var, unsigned int qp, Scalar* hess ) const
+  { this->hessian( FIXED_SOLUTION, var, qp, hess ); }
+
+  template<typename Scalar>
+  inline
+  Scalar ElementAssembly<Scalar>::interior_rate( VariableIndex var, unsigned int qp ) const
+  { return this->value( SOLUTION_RATE, var, qp ); }
+
+  template<typename Scalar>
+  inline
+  void ElementAssembly<Scalar>::add_residual( VariableIndex var, unsigned int i, const Scalar& value )
+  { this->scatter( var, i, value ); }
+
+} // end namespace GRINS
+
+#endif // GRINS_ELEMENT_ASSEMBLY_H
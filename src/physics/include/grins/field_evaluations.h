@@ -0,0 +1,145 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_FIELD_EVALUATIONS_H
+#define GRINS_FIELD_EVALUATIONS_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/var_typedefs.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/vector_value.h"
+#include "libmesh/tensor_value.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class FEMContext;
+}
+
+namespace GRINS
+{
+  //! Solution values, gradients and Hessians at the element interior quadrature points
+  /*!
+    Physics register the variables they need in init_context() via
+    AssemblyContext::request_field_values() and friends. MultiphysicsSystem
+    then evaluates every requested quantity once per element, before any
+    Physics residual is called, so that Physics sharing a variable don't
+    each redo the same shape function contractions through
+    FEMContext::interior_value() and friends.
+
+    Only element interior residuals are evaluated; the accessors assert if
+    they are used elsewhere (e.g. in side residuals). Quantities are of the
+    current element solution, as with FEMContext::interior_value(), not the
+    "fixed" solution.
+   */
+  class FieldEvaluations
+  {
+  public:
+
+    FieldEvaluations();
+    ~FieldEvaluations(){};
+
+    void request_values( VariableIndex var );
+
+    void request_gradients( VariableIndex var );
+
+    void request_hessians( VariableIndex var );
+
+    //! Whether any quantity has been requested
+    bool empty() const
+    { return _requested_vars.empty(); }
+
+    //! Evaluate all requested quantities on the current element
+    void evaluate( const libMesh::FEMContext& context );
+
+    //! Mark the stored quantities as not belonging to the current element
+    void invalidate()
+    { _evaluated = false; }
+
+    //! Values of var at each quadrature point
+    const std::vector<libMesh::Number>& values( VariableIndex var ) const;
+
+    //! Gradients of var at each quadrature point
+    const std::vector<libMesh::Gradient>& gradients( VariableIndex var ) const;
+
+    //! Hessians of var at each quadrature point
+    const std::vector<libMesh::Tensor>& hessians( VariableIndex var ) const;
+
+  private:
+
+    //! Flag var in flags, growing the per-variable storage as needed
+    void request( VariableIndex var, std::vector<bool>& flags );
+
+    //! Variables with any requested quantity
+    std::vector<VariableIndex> _requested_vars;
+
+    //! Requested quantities, indexed by variable
+    std::vector<bool> _need_values, _need_gradients, _need_hessians;
+
+    //! Evaluated quantities, indexed by variable then quadrature point
+    std::vector<std::vector<libMesh::Number> > _values;
+    std::vector<std::vector<libMesh::Gradient> > _gradients;
+    std::vector<std::vector<libMesh::Tensor> > _hessians;
+
+    //! Whether the quantities are for the current element
+    bool _evaluated;
+
+  };
+
+  inline
+  const std::vector<libMesh::Number>& FieldEvaluations::values( VariableIndex var ) const
+  {
+    libmesh_assert(_evaluated);
+    libmesh_assert_less(var, _need_values.size());
+    libmesh_assert(_need_values[var]);
+    return _values[var];
+  }
+
+  inline
+  const std::vector<libMesh::Gradient>& FieldEvaluations::gradients( VariableIndex var ) const
+  {
+    libmesh_assert(_evaluated);
+    libmesh_assert_less(var, _need_gradients.size());
+    libmesh_assert(_need_gradients[var]);
+    return _gradients[var];
+  }
+
+  inline
+  const std::vector<libMesh::Tensor>& FieldEvaluations::hessians( VariableIndex var ) const
+  {
+    libmesh_assert(_evaluated);
+    libmesh_assert_less(var, _need_hessians.size());
+    libmesh_assert(_need_hessians[var]);
+    return _hessians[var];
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_FIELD_EVALUATIONS_H
@@ -58,6 +58,10 @@ namespace GRINS
 				AssemblyContext& context,
 				CachedValues& cache );
 
+    //! Temperature residual depends only on temperature
+    virtual void declare_variable_coupling( const libMesh::System& system,
+                                            libMesh::CouplingMatrix& coupling ) const;
+
     // Registers all parameters in this physics and in its property
     // classes
     virtual void register_parameter
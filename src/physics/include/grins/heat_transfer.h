@@ -62,6 +62,10 @@ namespace GRINS
 				AssemblyContext& context,
 				CachedValues& cache );
 
+    //! Temperature residual depends on temperature and velocity
+    virtual void declare_variable_coupling( const libMesh::System& system,
+                                            libMesh::CouplingMatrix& coupling ) const;
+
     //! Compute value of postprocessed quantities at libMesh::Point.
     virtual void compute_postprocessed_quantity( unsigned int quantity_index,
                                                  const AssemblyContext& context,
@@ -48,10 +48,19 @@ namespace GRINS
     virtual void mass_residual( bool compute_jacobian,
                                 AssemblyContext& context,
                                 CachedValues& cache );
-    
+
+    //! Exact element_time_derivative Jacobian through the DualNumber path
+    virtual bool ad_residual( PhysicsDispatchTable::ResidualType type,
+                              AssemblyContext& context,
+                              CachedValues& cache );
+
   private:
     HeatTransferSPGSMStabilization();
 
+    //! element_time_derivative residual for any scalar type, see ElementAssembly
+    template<typename Scalar>
+    void assemble_element_time_derivative( ElementAssembly<Scalar>& assembly );
+
   }; // End HeatTransferSPGSMStabilization class declarations
 
 } // End namespace GRINS
@@ -28,6 +28,7 @@
 //GRINS
 #include "grins/stab_helper.h"
 #include "grins/assembly_context.h"
+#include "grins/element_assembly.h"
 
 // libMesh forward declarations
 class GetPot;
@@ -101,6 +102,24 @@ namespace GRINS
                                         libMesh::Gradient &d_tau_E_d_U,
                                         bool is_steady ) const;
 
+    //! compute_res_energy_steady() for any scalar type, see ElementAssembly
+    template<typename Scalar>
+    Scalar compute_res_energy_steady( const ElementAssembly<Scalar>& assembly,
+                                      unsigned int qp,
+                                      const libMesh::Real rho,
+                                      const libMesh::Real Cp,
+                                      const libMesh::Real k ) const;
+
+    //! compute_tau_energy() for any scalar type, U has LIBMESH_DIM entries
+    template<typename Scalar>
+    Scalar compute_tau_energy( AssemblyContext& c,
+                               const libMesh::RealTensor& G,
+                               libMesh::Real rho,
+                               libMesh::Real cp,
+                               libMesh::Real k,
+                               const Scalar* U,
+                               bool is_steady ) const;
+
   protected:
 
     libMesh::Real _C, _tau_factor;
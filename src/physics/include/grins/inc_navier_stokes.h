@@ -92,6 +92,14 @@ namespace GRINS
   private:
     IncompressibleNavierStokes();
 
+    //! Kernel for element_time_derivative, specialized on dimension and axisymmetry
+    /*! element_time_derivative() selects the instantiation once per element
+        so the quadrature and dof loops are free of dimension and
+        axisymmetry branches. */
+    template<unsigned int Dim, bool IsAxisymmetric>
+    void element_time_derivative_impl( bool compute_jacobian,
+                                       AssemblyContext& context );
+
   };
 
 } //End namespace block
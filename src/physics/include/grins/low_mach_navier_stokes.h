@@ -127,6 +127,12 @@ namespace GRINS
 
     LowMachNavierStokes();
 
+    //! Kernel for assemble_momentum_time_deriv, specialized on dimension
+    template<unsigned int Dim>
+    void assemble_momentum_time_deriv_impl( bool compute_jacobian,
+                                            AssemblyContext& context,
+                                            CachedValues& cache );
+
   };
 
 } //End namespace block
@@ -27,15 +27,20 @@
 #define GRINS_MULTIPHYSICS_SYS_H
 
 // C++
+#include <map>
 #include <string>
+#include <vector>
 
 // GRINS
 #include "grins_config.h"
 #include "grins/physics.h"
 #include "grins/neumann_bc_container.h"
+#include "grins/physics_dispatch_table.h"
 
 // libMesh
+#include "libmesh/coupling_matrix.h"
 #include "libmesh/fem_system.h"
+#include "libmesh/threads.h"
 
 #ifdef GRINS_HAVE_GRVY
 // GRVY timers
@@ -137,6 +142,19 @@ namespace GRINS
         such as point locators. */
     virtual void reinit();
 
+    //! Select which Physics terms following assemblies include
+    /*! RESIDUAL_TERMS skips Physics whose jfnk_terms() are
+        PRECONDITIONER_TERMS and vice versa. Used by JFNKSolver, which
+        sets this back to ALL_TERMS when it's done. */
+    void set_jfnk_assembly_terms( Physics::JFNKTerms terms )
+    { _jfnk_assembly_terms = terms; }
+
+    //! Whether init_data() projects the Physics initial conditions
+    /*! Turned off when the solution is restored from a checkpoint
+        right afterwards anyway. Must be set before initialization. */
+    void set_project_initial_conditions( bool project_ics )
+    { _project_ics = project_ics; }
+
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
 
@@ -209,6 +227,47 @@ namespace GRINS
 
     bool _use_numerical_jacobians_only;
 
+    //! Assemble Jacobians through Physics::ad_residual() where available
+    /*! Set with linear-nonlinear-solver/jacobian_mode = ad */
+    bool _use_ad_jacobians;
+
+    //! Finite difference element Jacobians using the declared variable coupling
+    /*! Only used together with numerical Jacobians. Set with
+        linear-nonlinear-solver/colored_numerical_jacobians, default false. */
+    bool _use_colored_numerical_jacobians;
+
+    //! Union of Physics::declare_variable_coupling() over all Physics
+    libMesh::CouplingMatrix _variable_coupling;
+
+    //! Restrict the matrix sparsity pattern to the declared variable coupling
+    /*! Set with linear-nonlinear-solver/sparse_variable_coupling, default false. */
+    bool _use_sparse_variable_coupling;
+
+    //! Variable coupling handed to the DofMap
+    /*! _variable_coupling plus full rows for the variables with Neumann
+        BCs, which may depend on any variable. The DofMap keeps a pointer
+        to this, so it must live as long as the system. */
+    libMesh::CouplingMatrix _dof_coupling;
+
+    //! For each Physics, the variables its residuals were declared to depend on
+    std::map<const Physics*,std::vector<bool> > _physics_coupled_vars;
+
+    //! Variables whose dofs can be perturbed together
+    /*! No variable's residual depends on more than one of the variables
+        in a group, so perturbing the k-th dof of every variable in
+        the group at once gives the k-th Jacobian column of each of them. */
+    std::vector<std::vector<VariableIndex> > _fd_variable_groups;
+
+    //! Store the system matrix in blocks of all the variables at a node
+    /*! Set with linear-nonlinear-solver/block_matrix, default false. */
+    bool _use_block_matrix;
+
+    //! Physics terms included in assembly, see set_jfnk_assembly_terms()
+    Physics::JFNKTerms _jfnk_assembly_terms;
+
+    //! See set_project_initial_conditions(), default true
+    bool _project_ics;
+
     // A list of names of variables who need their own numerical
     // jacobian deltas
     std::vector<std::string> _numerical_jacobian_h_variables;
@@ -229,6 +288,16 @@ namespace GRINS
         libMesh::UniquePtr may still actually be an AutoPtr. */
     std::vector<SharedPtr<NeumannBCContainer> > _neumann_bcs;
 
+    //! Physics to call for each residual type and subdomain
+    /*! Built in init_data() and copied into each AssemblyContext
+        in init_context(). Physics found to not override a hook are pruned
+        from the context's copy and from this one, so contexts built for
+        later assemblies start out pruned. */
+    PhysicsDispatchTable _dispatch_table;
+
+    //! Guards _dispatch_table against concurrent pruning and copying
+    libMesh::Threads::spin_mutex _dispatch_table_mutex;
+
 #ifdef GRINS_USE_GRVY_TIMERS
     GRVY::GRVY_Timer_Class* _timer;
 #endif
@@ -240,9 +309,54 @@ namespace GRINS
     // Refactored residual evaluation implementation
     bool _general_residual( bool request_jacobian,
 			    libMesh::DiffContext& context,
+                            PhysicsDispatchTable::ResidualType type,
                             ResFuncType resfunc,
                             CacheFuncType cachefunc);
 
+    //! Whether physics is left out of assembly by set_jfnk_assembly_terms()
+    bool skip_jfnk_terms( const Physics& physics ) const
+    { return ( _jfnk_assembly_terms != Physics::ALL_TERMS &&
+               physics.jfnk_terms() != Physics::ALL_TERMS &&
+               physics.jfnk_terms() != _jfnk_assembly_terms ); }
+
+    //! Collect the variable coupling declared by each Physics and build _fd_variable_groups
+    void build_variable_coupling();
+
+    //! Check the variables can be stored in blocks and return the block size
+    unsigned int matrix_block_size() const;
+
+    //! Error out unless the DofMap and the system matrix use block_size
+    void check_matrix_block_size( unsigned int block_size ) const;
+
+    //! Let the system matrix drop zero entries outside the sparsity pattern
+    /*! Element Jacobians are dense, so with sparse_variable_coupling they
+        contain zeros in blocks that aren't in the sparsity pattern. */
+    void ignore_zero_matrix_entries();
+
+    //! Finite difference the element Jacobian of the residual of the given type
+    /*! Perturbs one group of _fd_variable_groups at a time and only reevaluates
+        the Physics that depend on the group. The Jacobian is scaled following
+        the same solution/rate derivative conventions as analytic Jacobians. */
+    void colored_numerical_jacobian( AssemblyContext& c,
+                                     PhysicsDispatchTable::ResidualType type,
+                                     ResFuncType resfunc,
+                                     CacheFuncType cachefunc,
+                                     bool evaluate_fields );
+
+    //! Residual of the given type from the Physics depending on any variable in group
+    void evaluate_residual_subset( AssemblyContext& c,
+                                   PhysicsDispatchTable::ResidualType type,
+                                   ResFuncType resfunc,
+                                   CacheFuncType cachefunc,
+                                   bool evaluate_fields,
+                                   const std::vector<VariableIndex>& group );
+
+    //! Remove physics from the residual (or cache) list for type in context_table and _dispatch_table
+    void remove_noop_physics( PhysicsDispatchTable& context_table,
+                              PhysicsDispatchTable::ResidualType type,
+                              const Physics* physics,
+                              bool cache_function );
+
     //! Extract the bcs from neumann_bcs that are active on bc_id and return them in active_neumann_bcs
     void get_active_neumann_bcs( BoundaryID bc_id,
                                  const std::vector<SharedPtr<NeumannBCContainer> >& neumann_bcs,
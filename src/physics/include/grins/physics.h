@@ -61,6 +61,7 @@ namespace libMesh
 
   class FEMSystem;
   class Elem;
+  class CouplingMatrix;
 
   template <typename Scalar>
   class ParameterMultiAccessor;
@@ -114,6 +115,12 @@ namespace GRINS
 
   public:
 
+    //! Which assemblies the terms of a Physics go into under JFNK
+    /*! See jfnk_terms(). */
+    enum JFNKTerms { ALL_TERMS = 0,
+                     RESIDUAL_TERMS,
+                     PRECONDITIONER_TERMS };
+
     Physics( const GRINS::PhysicsName& physics_name, const GetPot& input );
     virtual ~Physics();
 
@@ -123,6 +130,20 @@ namespace GRINS
     //! Find if current physics is active on supplied element
     virtual bool enabled_on_elem( const libMesh::Elem* elem );
 
+    //! Subdomains on which this physics is enabled, empty means all subdomains
+    const std::set<libMesh::subdomain_id_type>& enabled_subdomains() const
+    { return _enabled_subdomains; }
+
+    //! Which assemblies this Physics contributes to when solving with JFNK
+    /*! Set with Physics/<physics_name>/jfnk_terms. With 'residual', the
+        terms are left out of the assembled preconditioner matrix but
+        still seen by the Krylov solver through the residual. With
+        'preconditioner', they are only assembled into the preconditioner.
+        The default, 'all', goes into both. Ignored unless
+        linear-nonlinear-solver/nonlinear_solver = jfnk. */
+    JFNKTerms jfnk_terms() const
+    { return _jfnk_terms; }
+
     //! Sets whether this physics is to be solved with a steady solver or not
     /*! Since the member variable is static, only needs to be called on a single
       physics. */
@@ -175,6 +196,11 @@ namespace GRINS
 
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
+    //
+    // The Physics base class versions of these and of the compute_*_cache
+    // functions do nothing except call AssemblyContext::flag_noop_hook(),
+    // so that MultiphysicsSystem stops calling them. Subclasses overriding
+    // these must not call the base class versions.
 
     //! Time dependent part(s) of physics for element interiors
     virtual void element_time_derivative( bool compute_jacobian,
@@ -221,6 +247,27 @@ namespace GRINS
                                          AssemblyContext& context,
                                          CachedValues& cache );
 
+    //! Residual of the given type and its exact element Jacobian through forward-mode AD
+    /*! Physics whose residual for type is written as a template on the
+        scalar type (see ElementAssembly) override this to assemble it with
+        DualNumber scalars and return true. MultiphysicsSystem only calls this
+        when linear-nonlinear-solver/jacobian_mode = ad and a Jacobian is
+        requested, instead of the corresponding hook above. The base class
+        returns false, in which case the hook above is called as usual. */
+    virtual bool ad_residual( PhysicsDispatchTable::ResidualType type,
+                              AssemblyContext& context,
+                              CachedValues& cache );
+
+    //! Declare which variables the residuals of this Physics depend on
+    /*! Set coupling(i,j) for every variable i this Physics adds residual
+        terms to and every variable j those terms depend on. Entries
+        already set by other Physics must be left alone. MultiphysicsSystem
+        uses this to restrict finite differenced element Jacobians to the
+        blocks that can be nonzero. The default declares every variable in
+        system as depending on every other, which is always safe. */
+    virtual void declare_variable_coupling( const libMesh::System& system,
+                                            libMesh::CouplingMatrix& coupling ) const;
+
     void init_ics( libMesh::FEMSystem* system,
                    libMesh::CompositeFunction<libMesh::Number>& all_ics );
 
@@ -272,6 +319,9 @@ namespace GRINS
     void parse_enabled_subdomains( const GetPot& input,
                                    const std::string& physics_name );
 
+    void parse_jfnk_terms( const GetPot& input,
+                           const std::string& physics_name );
+
     //! Check that var is enabled on at least the subdomains this Physics is
     void check_var_subdomain_consistency( const FEVariablesBase& var ) const;
 
@@ -288,6 +338,8 @@ namespace GRINS
     //! Subdomains on which the current Physics class is enabled
     std::set<libMesh::subdomain_id_type> _enabled_subdomains;
 
+    JFNKTerms _jfnk_terms;
+
     //! Caches whether or not the solver that's being used is steady or not.
     /*! This is need, for example, in flow stabilization as the tau terms change
       depending on whether the solver is steady or unsteady. */
@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PHYSICS_DISPATCH_TABLE_H
+#define GRINS_PHYSICS_DISPATCH_TABLE_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/var_typedefs.h"
+
+// libMesh
+#include "libmesh/id_types.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class Elem;
+}
+
+namespace GRINS
+{
+  //! Flat lists of the Physics that contribute to each residual type
+  /*!
+    MultiphysicsSystem builds one of these from its PhysicsList after
+    init_data() so that element assembly is an indexed loop over only
+    the Physics that are enabled on the current subdomain, rather than a
+    traversal of the PhysicsList with a subdomain set lookup per Physics.
+
+    Physics whose hooks turn out to be the (empty) Physics base class
+    implementations are removed as they are discovered, see
+    AssemblyContext::flag_noop_hook(). Each AssemblyContext holds its own
+    copy so that removal during threaded assembly needs no locking.
+   */
+  class PhysicsDispatchTable
+  {
+  public:
+
+    //! Residual types assembled by MultiphysicsSystem
+    enum ResidualType{ ELEMENT_TIME_DERIVATIVE = 0,
+                       SIDE_TIME_DERIVATIVE,
+                       NONLOCAL_TIME_DERIVATIVE,
+                       ELEMENT_CONSTRAINT,
+                       SIDE_CONSTRAINT,
+                       NONLOCAL_CONSTRAINT,
+                       DAMPING_RESIDUAL,
+                       MASS_RESIDUAL,
+                       NONLOCAL_MASS_RESIDUAL,
+                       N_RESIDUAL_TYPES };
+
+    PhysicsDispatchTable();
+    ~PhysicsDispatchTable(){};
+
+    //! (Re)build all the lists from the Physics in physics_list
+    void build( const PhysicsList& physics_list );
+
+    //! Physics whose cache functions should be called for residual type
+    /*! Cache functions are called for all Physics, regardless of the
+        subdomain, since one Physics may consume values cached by another. */
+    const std::vector<Physics*>& cache_physics( ResidualType type ) const
+    { return _cache_physics[type]; }
+
+    //! Physics whose residual functions should be called for type on elem
+    /*! elem may be NULL for nonlocal evaluations, in which case all Physics
+        are returned. */
+    const std::vector<Physics*>& residual_physics( ResidualType type,
+                                                  const libMesh::Elem* elem ) const;
+
+    //! Remove physics from the cache list of type
+    void remove_cache_physics( ResidualType type, const Physics* physics );
+
+    //! Remove physics from the residual lists of type, on all subdomains
+    void remove_residual_physics( ResidualType type, const Physics* physics );
+
+  private:
+
+    //! Slot for evaluations without an element
+    static const unsigned int _nonlocal_slot = 0;
+
+    //! Slot for subdomains not named by any Physics
+    static const unsigned int _default_slot = 1;
+
+    void remove_physics( std::vector<Physics*>& list, const Physics* physics );
+
+    //! Maps subdomain id to its slot, subdomains past the end use _default_slot
+    std::vector<unsigned int> _subdomain_slot;
+
+    //! _residual_physics[type][slot]
+    std::vector<std::vector<std::vector<Physics*> > > _residual_physics;
+
+    //! _cache_physics[type]
+    std::vector<std::vector<Physics*> > _cache_physics;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_PHYSICS_DISPATCH_TABLE_H
@@ -75,6 +75,73 @@ namespace GRINS
 
   protected:
 
+    //! Layout of the pointwise property bundle used by the analytic Jacobians
+    /*! The scalar properties come first, followed by \f$ D_s \f$,
+        \f$ \dot{\omega}_s \f$ and \f$ h_s \f$ for each species. The
+        mass residual only needs the thermodynamic properties, so they are
+        stored ahead of the transport ones. */
+    enum PropertyIndex { RHO_PROP = 0,
+                         CP_PROP,
+                         M_PROP,
+                         N_THERMO_PROPS,
+                         MU_PROP = N_THERMO_PROPS,
+                         K_PROP,
+                         N_SCALAR_PROPS };
+
+    //! Number of entries in one property bundle
+    unsigned int n_props( bool thermo_only ) const
+    { return thermo_only ? N_THERMO_PROPS : N_SCALAR_PROPS + 3*this->_n_species; }
+
+    //! Number of property bundles filled by evaluate_property_derivatives
+    unsigned int n_prop_bundles() const
+    { return this->_enable_thermo_press_calc ? 3 + this->_n_species : 2 + this->_n_species; }
+
+    //! Bundle holding the thermodynamic pressure sensitivities
+    /*! Only present when the thermodynamic pressure is a solution variable. */
+    unsigned int p0_bundle() const
+    { return 2 + this->_n_species; }
+
+    unsigned int D_prop( unsigned int s ) const
+    { return N_SCALAR_PROPS + s; }
+
+    unsigned int omega_dot_prop( unsigned int s ) const
+    { return N_SCALAR_PROPS + this->_n_species + s; }
+
+    unsigned int h_prop( unsigned int s ) const
+    { return N_SCALAR_PROPS + 2*this->_n_species + s; }
+
+    //! Evaluate the property bundle at a single state
+    /*! D and omega_dot are work vectors of size n_species(). If thermo_only
+        is true, only the first N_THERMO_PROPS entries of props are set. */
+    void evaluate_properties( Evaluator& gas_evaluator,
+                              libMesh::Real T,
+                              libMesh::Real p0,
+                              const std::vector<libMesh::Real>& Y,
+                              bool thermo_only,
+                              std::vector<libMesh::Real>& D,
+                              std::vector<libMesh::Real>& omega_dot,
+                              libMesh::Real* props );
+
+    //! Evaluate the property bundle and its sensitivities to T, Y_s and p0
+    /*! The Evaluator only exposes property values, so the sensitivities are
+        computed by second order differences of the pointwise property
+        evaluation; no residual is ever differenced. On return, props holds
+        the bundle at (T,Y), followed by its T derivative, followed by its
+        derivative with respect to each Y_s and, with
+        enable_thermo_press_calc, with respect to p0, i.e.
+        n_prop_bundles()*n_props() entries. */
+    void evaluate_property_derivatives( Evaluator& gas_evaluator,
+                                        libMesh::Real T,
+                                        libMesh::Real p0,
+                                        const std::vector<libMesh::Real>& Y,
+                                        bool thermo_only,
+                                        ScratchWorkspace& workspace,
+                                        std::vector<libMesh::Real>& props );
+
+    //! Assemble the analytic Jacobian of element_time_derivative
+    void element_time_derivative_jacobian( AssemblyContext& context,
+                                           const CachedValues& cache );
+
     //! Enable pressure pinning
     bool _pin_pressure;
     
@@ -53,6 +53,12 @@ namespace GRINS
     // Context initialization
     virtual void init_context( AssemblyContext& context );
 
+    //! Every equation depends on every variable of the reacting flow, but nothing else
+    /*! Species residuals are coupled to all species through the density,
+        the mixture transport properties and the chemical source terms. */
+    virtual void declare_variable_coupling( const libMesh::System& system,
+                                            libMesh::CouplingMatrix& coupling ) const;
+
     unsigned int n_species() const;
 
     libMesh::Real T( const libMesh::Point& p, const AssemblyContext& c ) const;
@@ -79,6 +79,10 @@ namespace GRINS
 				          AssemblyContext& context,
 				          CachedValues& cache );
 
+    //! The user-specified functions may depend on any variable
+    virtual void declare_variable_coupling( const libMesh::System& system,
+                                            libMesh::CouplingMatrix& coupling ) const;
+
     VariableIndex scalar_ode_var() const { return _var.var(); }
 
   private:
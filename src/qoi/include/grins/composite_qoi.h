@@ -126,6 +126,9 @@ namespace GRINS
     //! Accessor for value of QoI for given qoi_index.
     libMesh::Number get_qoi_value( unsigned int qoi_index ) const;
 
+    //! Overrides the value of QoI for given qoi_index.
+    void set_qoi_value( unsigned int qoi_index, libMesh::Number value );
+
     const QoIBase& get_qoi( unsigned int qoi_index ) const;
 
   protected:
@@ -119,6 +119,9 @@ namespace GRINS
     //! Returns the current QoI value.
     libMesh::Number value() const;
 
+    //! Overrides the cached value, e.g. with the time integral of the QoI
+    void set_value( libMesh::Number value );
+
     //! Returns the name of this QoI
     const std::string& name() const;
 
@@ -135,6 +138,12 @@ namespace GRINS
     return _qoi_value;
   }
 
+  inline
+  void QoIBase::set_value( libMesh::Number value )
+  {
+    _qoi_value = value;
+  }
+
   inline
   const std::string& QoIBase::name() const
   {
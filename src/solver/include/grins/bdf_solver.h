@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_BDF_SOLVER_H
+#define GRINS_BDF_SOLVER_H
+
+// C++
+#include <string>
+#include <vector>
+
+// GRINS
+#include "grins/implicit_stage_time_solver.h"
+
+namespace GRINS
+{
+  //! Variable step size, variable order backward differentiation formulas
+  /*!
+    The BDF of order k approximates the solution rate at \f$ t_{n+1} \f$ by
+    the derivative of the polynomial interpolating the new solution and the
+    last k solutions at their actual times, so the step size may change
+    from step to step. Orders 1 to 5 are supported; only orders 1 and 2 are
+    A-stable. The order ramps up from backward Euler as solution history
+    accumulates.
+
+    The local error estimate compares the new solution with the
+    extrapolation of the last k+1 solutions, as in DASSL, so it costs no
+    extra solves. With adaptive time stepping, the error estimates for
+    orders k-1 and k+1 are computed the same way and the order giving the
+    largest next step is chosen. The order is only raised after k+1 steps
+    at order k.
+
+    Selected with SolverOptions/TimeStepping/solver_type = grins_bdf_solver,
+    the maximum order with SolverOptions/TimeStepping/bdf_max_order.
+   */
+  class BDFSolver : public ImplicitStageTimeSolver
+  {
+  public:
+
+    BDFSolver( sys_type& system, unsigned int max_order );
+    virtual ~BDFSolver();
+
+    virtual void init();
+
+    //! Also starts over at first order
+    virtual void restart();
+
+    //! Order, history length and history times
+    virtual void write_checkpoint_info( std::ostream& info ) const;
+
+    virtual void read_checkpoint_info( const GetPot& info );
+
+    //! Order of the last step
+    virtual libMesh::Real error_order() const
+    { return _step_order; }
+
+  protected:
+
+    virtual unsigned int take_step();
+
+    virtual bool compute_error_estimate( libMesh::NumericVector<libMesh::Number>& error );
+
+    virtual unsigned int error_estimate_order() const
+    { return _step_order; }
+
+    virtual void accept_step();
+
+    //! Also picks the order of the next step
+    virtual libMesh::Real step_size_factor( libMesh::Real relative_error, bool step_accepted );
+
+    //! Solution at \f$ t_{n+1-j} \f$, j >= 1
+    const libMesh::NumericVector<libMesh::Number>& history( unsigned int j ) const;
+
+    //! \f$ t_{n+1-j} \f$, j >= 0
+    libMesh::Real history_time( unsigned int j ) const;
+
+    //! BDF weights of the solutions at \f$ t_{n+1-j} \f$, j = 0, ..., order
+    void bdf_coefficients( unsigned int order, std::vector<libMesh::Real>& alpha ) const;
+
+    //! Error estimate of the BDF of the given order from the polynomial predictor
+    void predictor_error( unsigned int order,
+                          libMesh::NumericVector<libMesh::Number>& error ) const;
+
+    unsigned int _max_order;
+
+    //! Order to take the next step with, if there is enough history
+    unsigned int _order;
+
+    //! Order of the last step
+    unsigned int _step_order;
+
+    unsigned int _steps_at_order;
+
+    //! Names of the vectors with the solutions at \f$ t_{n-1} \f$, \f$ t_{n-2} \f$, ...
+    std::vector<std::string> _history_names;
+
+    //! Times of the solutions in _history_names
+    std::vector<libMesh::Real> _history_times;
+
+    //! Number of valid solutions in _history_names
+    unsigned int _n_history;
+
+    //! Relative error estimates of the last step for orders k-1 and k+1, or -1
+    libMesh::Real _lower_order_error;
+    libMesh::Real _higher_order_error;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_BDF_SOLVER_H
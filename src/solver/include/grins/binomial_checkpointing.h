@@ -0,0 +1,126 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_BINOMIAL_CHECKPOINTING_H
+#define GRINS_BINOMIAL_CHECKPOINTING_H
+
+// C++
+#include <map>
+#include <set>
+#include <string>
+
+// GRINS
+#include "grins/shared_ptr.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  template <typename T> class NumericVector;
+}
+
+namespace GRINS
+{
+  //! Forward states for the reverse sweep of an unsteady adjoint solve
+  /*!
+    Holds up to n_memory solution snapshots in memory and up to n_disk
+    more on disk, each processor writing its local entries to
+    <directory>/<timestep>.<rank>.dat. Which time steps to keep follows
+    the binomial (revolve) schedule given by split(): reversing l time
+    steps with s free snapshots needs at most t recomputations of each
+    step, where t is the smallest number with binomial(s+t,s) >= l.
+   */
+  class BinomialCheckpointing
+  {
+  public:
+
+    BinomialCheckpointing( unsigned int n_memory,
+                           unsigned int n_disk,
+                           const std::string& directory );
+
+    //! Removes the disk snapshots
+    ~BinomialCheckpointing();
+
+    //! Total number of snapshots we can hold
+    unsigned int capacity() const
+    { return _n_memory + _n_disk; }
+
+    //! Number of snapshots not in use
+    unsigned int n_free() const
+    { return this->capacity() - _memory.size() - _disk.size(); }
+
+    bool has( unsigned int timestep ) const
+    { return _memory.count(timestep) || _disk.count(timestep); }
+
+    //! Keep solution as the state after timestep, in memory if we still can
+    void store( unsigned int timestep,
+                const libMesh::NumericVector<libMesh::Number>& solution );
+
+    //! Copy the stored state after timestep into solution
+    void load( unsigned int timestep,
+               libMesh::NumericVector<libMesh::Number>& solution ) const;
+
+    void erase( unsigned int timestep );
+
+    void clear();
+
+    //! Where to take the next snapshot for reversing time steps [begin,end)
+    /*! Assumes the state at begin is stored and n_free snapshots are left
+        for the ones in between. The part after the returned time step
+        is reversed with one snapshot less, the part before it with the
+        same number again. */
+    static unsigned int split( unsigned int begin, unsigned int end,
+                               unsigned int n_free );
+
+  private:
+
+    //! binomial(s+t,s), the most time steps s snapshots and t recomputations can reverse
+    static libMesh::Real max_timesteps( unsigned int s, unsigned int t );
+
+    std::string filename( unsigned int timestep, unsigned int rank ) const;
+
+    unsigned int _n_memory;
+
+    unsigned int _n_disk;
+
+    std::string _directory;
+
+    //! Whether we created _directory yet
+    bool _have_directory;
+
+    std::map<unsigned int, SharedPtr<libMesh::NumericVector<libMesh::Number> > > _memory;
+
+    //! Time steps whose snapshot is on disk
+    std::set<unsigned int> _disk;
+
+    //! Our rank, for the disk snapshot file names
+    unsigned int _rank;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_BINOMIAL_CHECKPOINTING_H
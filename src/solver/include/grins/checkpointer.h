@@ -0,0 +1,207 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_CHECKPOINTER_H
+#define GRINS_CHECKPOINTER_H
+
+// C++
+#include <ctime>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+#include <thread>
+#endif
+
+// libMesh forward declarations
+class GetPot;
+namespace libMesh
+{
+  class UnstructuredMesh;
+  template <typename T> class NumericVector;
+  namespace Parallel
+  {
+    class Communicator;
+  }
+}
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! Periodic checkpoints of unsteady runs and restart from them
+  /*!
+    A checkpoint is written every checkpoint-options/timesteps_per_checkpoint
+    time steps and/or whenever checkpoint-options/wall_time_per_checkpoint
+    seconds have passed since the last one. It consists of
+
+    - <prefix>.<timestep>/info: time, deltat, time step, mesh file and
+      the step history of BDF and ESDIRK solvers,
+    - <prefix>.<timestep>/<rank>.dat: the locally owned entries of the
+      solution and every additional vector of every system, which
+      includes the time solver history (old solution, Newmark rate and
+      acceleration, ...), in native binary,
+    - <prefix>_mesh.<n>/: the mesh including its refinement hierarchy, in
+      libMesh's CheckpointIO format. It's only rewritten after the mesh
+      changed.
+
+    Only the snapshot of the local vector entries is taken synchronously,
+    the .dat files are written on a background thread when libMesh has
+    thread support. A checkpoint is marked complete once every processor
+    has finished writing it, and only the last
+    checkpoint-options/n_checkpoints_to_keep complete checkpoints are kept.
+
+    Restarting with restart-options/restart_checkpoint reads the mesh
+    instead of building and refining it from the input file, so the
+    restart has to run on the same number of processors. The complete
+    checkpoints up to the restart time step count towards
+    n_checkpoints_to_keep of the restarted run.
+   */
+  class Checkpointer
+  {
+  public:
+
+    Checkpointer( const GetPot& input );
+
+    //! Waits for a checkpoint still being written
+    ~Checkpointer();
+
+    //! Write a checkpoint if one is due after completing time step timestep
+    /*! Must be called on all processors. */
+    void checkpoint( MultiphysicsSystem& system, unsigned int timestep );
+
+    //! Write a checkpoint of the current state
+    void write( MultiphysicsSystem& system, unsigned int timestep );
+
+    //! Finish writing the pending checkpoint and mark it complete
+    void flush( const libMesh::Parallel::Communicator& comm );
+
+    //! The mesh was refined or coarsened, so the next checkpoint writes it again
+    void mesh_changed()
+    { _mesh_version++;
+      _mesh_written = false; }
+
+    //! Read the mesh stored with checkpoint
+    static void read_mesh( const std::string& checkpoint,
+                           libMesh::UnstructuredMesh& mesh );
+
+    //! Restore the vectors, time and deltat of system from checkpoint
+    /*! The mesh must have been read with read_mesh(). */
+    void restart( const std::string& checkpoint, MultiphysicsSystem& system );
+
+    //! Whether we restarted from a checkpoint
+    bool restarted() const
+    { return _restarted; }
+
+    //! The time step to continue with after a restart
+    unsigned int restart_timestep() const
+    { return _restart_timestep; }
+
+  private:
+
+    //! Locally owned entries of one vector of one system
+    struct LocalVector
+    {
+      std::string system_name;
+      std::string vector_name;
+      libMesh::numeric_index_type first_local_index;
+      std::vector<libMesh::Number> values;
+    };
+
+    static void add_local_vector( const std::string& system_name,
+                                  const std::string& vector_name,
+                                  const libMesh::NumericVector<libMesh::Number>& vector,
+                                  std::vector<LocalVector>& vectors );
+
+    //! Write _pending_vectors to _pending_filename, catching any error
+    void write_pending_vectors();
+
+    static void write_local_vectors( const std::string& filename,
+                                     const std::vector<LocalVector>& vectors );
+
+    static void read_local_vectors( const std::string& filename,
+                                    std::vector<LocalVector>& vectors );
+
+    std::string checkpoint_name( unsigned int timestep ) const;
+
+    std::string mesh_name( unsigned int mesh_version ) const;
+
+    //! Pick up the complete checkpoints and mesh directories already on disk
+    /*! Called on restart so that n_checkpoints_to_keep covers the old
+        checkpoints too and new meshes don't overwrite old ones. */
+    void find_existing_checkpoints( const std::string& restored_mesh );
+
+    //! Remove dirname and the files in it
+    static void remove_directory( const std::string& dirname );
+
+    unsigned int _timesteps_per_checkpoint;
+
+    double _wall_time_per_checkpoint;
+
+    unsigned int _n_checkpoints_to_keep;
+
+    std::string _file_prefix;
+
+    std::time_t _last_checkpoint_wall_time;
+
+    //! Incremented on every mesh change
+    unsigned int _mesh_version;
+
+    //! Whether _mesh_version has been written yet
+    bool _mesh_written;
+
+    //! Checkpoint and mesh directories of the checkpoint being written
+    std::string _pending_checkpoint;
+    std::string _pending_mesh;
+
+    //! This processor's data of the checkpoint being written
+    std::string _pending_filename;
+    std::vector<LocalVector> _pending_vectors;
+
+    //! Error message from writing _pending_vectors, if any
+    std::string _write_error;
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+    std::thread _writer;
+#endif
+
+    //! Complete checkpoints and the mesh directory each uses, oldest first
+    std::deque<std::pair<std::string, std::string> > _complete_checkpoints;
+
+    bool _restarted;
+
+    unsigned int _restart_timestep;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_CHECKPOINTER_H
@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_CONTINUATION_DRIVER_H
+#define GRINS_CONTINUATION_DRIVER_H
+
+// C++
+#include <string>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  // Forward declarations
+  class Simulation;
+
+  //! Natural parameter continuation of a steady Simulation
+  /*!
+    Steps the parameter SolverOptions/Continuation/parameter, registered
+    through ParameterManager like the sensitivity parameters, from its
+    input value to SolverOptions/Continuation/final_value, solving the
+    steady problem at each value. Each solve starts from the previous
+    solution, moved along the tangent du/dp from the forward sensitivity
+    solve unless tangent_predictor is false.
+
+    The step grows or shrinks by the ratio of target_nonlinear_iterations
+    to the Newton iterations the last solve took, by at most a factor of
+    max_growth. Failed solves are retried from the last solution with half
+    the step. The solution is output with the step number as the time
+    step and the parameter value as the time, and the QoIs are output
+    after each step.
+   */
+  class ContinuationDriver
+  {
+  public:
+
+    ContinuationDriver( const GetPot& input );
+
+    ~ContinuationDriver(){};
+
+    //! Whether the input asks for a continuation parameter
+    static bool is_enabled( const GetPot& input );
+
+    //! Continue simulation, built from input, along the parameter path
+    void run( const GetPot& input, Simulation& simulation );
+
+  private:
+
+    std::string _parameter_name;
+
+    libMesh::Real _final_value;
+
+    libMesh::Real _initial_step;
+
+    libMesh::Real _min_step;
+
+    //! 0 means no upper bound
+    libMesh::Real _max_step;
+
+    libMesh::Real _target_nonlinear_iterations;
+
+    libMesh::Real _max_growth;
+
+    unsigned int _max_steps;
+
+    bool _tangent_predictor;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_CONTINUATION_DRIVER_H
@@ -0,0 +1,116 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_ESDIRK_SOLVER_H
+#define GRINS_ESDIRK_SOLVER_H
+
+// C++
+#include <string>
+#include <vector>
+
+// GRINS
+#include "grins/implicit_stage_time_solver.h"
+
+namespace GRINS
+{
+  //! L-stable, stiffly accurate explicit first stage singly diagonally implicit Runge-Kutta
+  /*!
+    Available schemes, selected with SolverOptions/TimeStepping/esdirk_scheme:
+
+    - esdirk2: TR-BDF2, second order with a third order embedded method,
+    - esdirk3: ESDIRK3(2)4L[2]SA of Kennedy and Carpenter,
+    - esdirk4: ESDIRK4(3)6L[2]SA of Kennedy and Carpenter.
+
+    Stages are solved for in stage derivative form, so a (possibly
+    nonlinear) mass matrix is fine. Since the schemes are stiffly accurate,
+    the last stage is the new solution and its stage derivative is reused
+    as the explicit first stage of the next step. For the very first step it
+    is approximated with a backward Euler solve over the first implicit
+    stage. The embedded method provides the local error estimate for
+    adaptive time stepping.
+
+    Selected with SolverOptions/TimeStepping/solver_type = grins_esdirk_solver.
+   */
+  class ESDIRKSolver : public ImplicitStageTimeSolver
+  {
+  public:
+
+    ESDIRKSolver( sys_type& system, const std::string& scheme );
+    virtual ~ESDIRKSolver();
+
+    virtual void init();
+
+    //! Also starts over with the backward Euler start up step
+    virtual void restart();
+
+    //! Whether the first stage rate is valid
+    virtual void write_checkpoint_info( std::ostream& info ) const;
+
+    virtual void read_checkpoint_info( const GetPot& info );
+
+    virtual libMesh::Real error_order() const
+    { return _order; }
+
+  protected:
+
+    virtual unsigned int take_step();
+
+    virtual bool compute_error_estimate( libMesh::NumericVector<libMesh::Number>& error );
+
+    virtual unsigned int error_estimate_order() const
+    { return _embedded_order; }
+
+    virtual void accept_step();
+
+    libMesh::NumericVector<libMesh::Number>& stage_rate( unsigned int stage );
+
+    //! Set the tableau from the row major n x n matrix a, c and b_embedded
+    void set_tableau( unsigned int n,
+                      const libMesh::Real* a,
+                      const libMesh::Real* c,
+                      const libMesh::Real* b_embedded );
+
+    unsigned int n_stages() const
+    { return _c.size(); }
+
+    //! Butcher tableau, the last row of _a is the solution weights
+    std::vector<std::vector<libMesh::Real> > _a;
+    std::vector<libMesh::Real> _c;
+    std::vector<libMesh::Real> _b_embedded;
+
+    unsigned int _order;
+
+    //! min(_order, embedded method order)
+    unsigned int _embedded_order;
+
+    std::vector<std::string> _stage_rate_names;
+
+    //! Whether the first stage rate holds the solution rate at t_n
+    bool _have_initial_rate;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_ESDIRK_SOLVER_H
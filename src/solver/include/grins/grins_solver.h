@@ -28,6 +28,7 @@
 
 // GRINS
 #include "grins/shared_ptr.h"
+#include "grins/inexact_newton_solver.h"
 
 // libMesh
 #include "libmesh/equation_systems.h"
@@ -89,6 +90,11 @@ namespace GRINS
 
     void print_scalar_vars( SolverContext& context );
 
+    //! Compute the QoIs of the solution
+    /*! Solvers whose QoIs aren't those of the current solution alone,
+        e.g. time integrated ones, override this. */
+    virtual void assemble_qoi( SolverContext& context );
+
     void print_qoi( SolverContext& context );
 
   protected:
@@ -111,6 +117,33 @@ namespace GRINS
     bool _continue_after_max_iterations;
     bool _require_residual_reduction;
 
+    //! Solve with JFNKSolver instead of libMesh::NewtonSolver
+    /*! Set with linear-nonlinear-solver/nonlinear_solver = jfnk */
+    bool _use_jfnk;
+
+    //! Finite difference step for JFNKSolver Jacobian-vector products
+    double _jfnk_fd_step;
+
+    //! Newton iterations to reuse the Jacobian for, see InexactNewtonSolver
+    unsigned int _jacobian_lag;
+
+    //! Newton iterations to reuse the JFNK preconditioner for
+    unsigned int _preconditioner_lag;
+
+    //! Reassemble a lagged matrix when the residual drops by less than this factor
+    double _lag_refresh_ratio;
+
+    //! Linear tolerance strategy, see InexactNewtonSolver::ForcingTerm
+    /*! Set with linear-nonlinear-solver/forcing_term = fixed,
+        eisenstat_walker_1 or eisenstat_walker_2 */
+    InexactNewtonSolver::ForcingTerm _forcing_term;
+
+    // Eisenstat-Walker parameters
+    double _forcing_gamma;
+    double _forcing_alpha;
+    double _max_forcing_term;
+    double _min_forcing_term;
+
     // Screen display options
     bool _solver_quiet;
     bool _solver_verbose;
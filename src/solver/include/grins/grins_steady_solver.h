@@ -28,6 +28,7 @@
 
 //GRINS
 #include "grins/grins_solver.h"
+#include "grins/pseudo_transient_options.h"
 
 namespace GRINS
 {
@@ -56,6 +57,26 @@ namespace GRINS
 
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
 
+    //! Pseudo time step until the residual is small enough for Newton's method
+    /*! The pseudo time step grows by switched evolution relaxation,
+        i.e. by the factor the steady residual decreased over the last
+        step, within the bounds of Strategies/PseudoTransient. Steps
+        that increase the steady residual or whose line search fails
+        are rolled back and retried with the step shrunk by
+        rejection_factor. */
+    void pseudo_transient_solve( SolverContext& context );
+
+    //! Solve on the unrefined mesh, then refine uniformly and solve again level by level
+    /*! Refining projects the solution, so each level starts from the
+        solution of the one before. Pseudo-transient continuation, if
+        enabled, is only used on the coarsest level. */
+    void grid_sequencing_solve( SolverContext& context );
+
+    PseudoTransientOptions _pseudo_transient_options;
+
+    //! Uniform refinements to solve on after the unrefined mesh, if Mesh/Refinement/grid_sequencing
+    unsigned int _grid_sequencing_levels;
+
   };
 } // namespace GRINS
 #endif // GRINS_STEADY_SOLVER_H
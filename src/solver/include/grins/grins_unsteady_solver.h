@@ -26,9 +26,18 @@
 #ifndef GRINS_UNSTEADY_SOLVER_H
 #define GRINS_UNSTEADY_SOLVER_H
 
+//C++
+#include <set>
+#include <vector>
+
 //GRINS
 #include "grins/grins_solver.h"
 #include "grins/adaptive_time_stepping_options.h"
+#include "grins/binomial_checkpointing.h"
+#include "grins/iteration_time_step_controller.h"
+#include "grins/shared_ptr.h"
+#include "grins/solution_predictor.h"
+#include "grins/unsteady_adjoint_options.h"
 
 //libMesh
 #include "libmesh/system_norm.h"
@@ -45,6 +54,28 @@ namespace GRINS
 
     virtual void solve( SolverContext& context );
 
+    //! With Strategies/UnsteadyAdjoint/qoi_time = 'integrated', the QoIs summed over the time steps of solve()
+    /*! Each time step is weighted by its deltat, as in
+        unsteady_adjoint_solve(). */
+    virtual void assemble_qoi( SolverContext& context );
+
+    //! Sensitivities of the QoIs of the time steps taken by solve()
+    /*! See unsteady_adjoint_solve(). */
+    virtual void adjoint_qoi_parameter_sensitivity
+      (SolverContext&                  context,
+       const libMesh::QoISet&          qoi_indices,
+       const libMesh::ParameterVector& parameters_in,
+       libMesh::SensitivityData&       sensitivities) const;
+
+    //! Time step from the current solution and time up to end_time, without any output
+    /*! Steps are of size deltat, or whatever the time solver adapts
+        that to, and the last one is shortened to end exactly at
+        end_time. The time solver starts over from the current solution.
+        This is how PararealDriver runs its coarse and fine propagators. */
+    void propagate( SolverContext& context,
+                    libMesh::Real end_time,
+                    libMesh::Real deltat );
+
   protected:
 
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
@@ -55,12 +86,42 @@ namespace GRINS
     //! Updates Dirichlet boundary conditions
     /*! If the Dirichlet boundary condition is nonlinear or time-dependent,
         we need to update the constraints with the new solution. */
-    void update_dirichlet_bcs( SolverContext& context );
+    void update_dirichlet_bcs( SolverContext& context ) const;
 
     void init_second_order_in_time_solvers( SolverContext& context );
 
+    //! Solves the current time step
+    /*! With iteration based time step control, steps the controller
+        rejects are retried from the last accepted solution. */
+    void solve_time_step( SolverContext& context );
+
+    //! Let the time solver start over from the current solution, as if it were the initial condition
+    void restart_time_solver( SolverContext& context );
+
+    //! Backward in time discrete adjoint solve over the time steps taken by solve()
+    /*! The forward states are recomputed from the snapshots solve() took
+        when context.do_adjoint_solve is set. The QoIs are those of the final
+        state or, with Strategies/UnsteadyAdjoint/qoi_time = 'integrated',
+        their sum over all time steps weighted by deltat. Afterwards the
+        adjoint solutions are those of the first time step and the system
+        is back at its final state. If parameters is given, the QoI
+        sensitivities to them are accumulated into sensitivities.
+
+        The cross time step terms are derived for backward Euler, so
+        init_adjoint_checkpoints() rejects other time solvers. */
+    void unsteady_adjoint_solve( SolverContext& context,
+                                 const libMesh::QoISet& qoi_indices,
+                                 const libMesh::ParameterVector* parameters,
+                                 libMesh::SensitivityData* sensitivities ) const;
+
     std::string _time_solver_name;
 
+    //! Highest order of BDFSolver
+    unsigned int _bdf_max_order;
+
+    //! Runge-Kutta scheme of ESDIRKSolver
+    std::string _esdirk_scheme;
+
     unsigned int _n_timesteps;
     unsigned int _backtrack_deltat;
     double _theta;
@@ -69,10 +130,68 @@ namespace GRINS
     // Options for adaptive time solvers
     AdaptiveTimeSteppingOptions _adapt_time_step_options;
 
+    //! Chooses deltat from solver iteration counts, if enabled
+    SharedPtr<IterationTimeStepController> _iteration_controller;
+
+    //! Extrapolates the initial guess of each time step, if enabled
+    SharedPtr<SolutionPredictor> _predictor;
+
     //! Track whether is this a second order (in time) solver or not
     /*! If it is, we need to potentially initialize the acceleration */
     bool _is_second_order_in_time;
 
+    UnsteadyAdjointOptions _adjoint_options;
+
+    //! Forward states for unsteady_adjoint_solve(), if we're doing one
+    SharedPtr<BinomialCheckpointing> _adjoint_checkpoints;
+
+    //! Time of the state after each time step, starting with the initial condition
+    std::vector<libMesh::Real> _adjoint_times;
+
+    //! Time steps solve() takes snapshots of, the first branch of the schedule
+    std::set<unsigned int> _forward_snapshots;
+
+    //! QoIs summed over the time steps of solve(), if they're time integrated
+    std::vector<libMesh::Number> _integrated_qoi;
+
+  private:
+
+    //! State of the reverse sweep of unsteady_adjoint_solve()
+    struct AdjointSweep;
+
+    //! Start recording the forward states for the adjoint solve
+    void init_adjoint_checkpoints( SolverContext& context );
+
+    //! Record the state after timestep
+    void record_adjoint_state( SolverContext& context, unsigned int timestep );
+
+    //! Add the QoIs of the current state, weighted by deltat, to _integrated_qoi
+    void integrate_qoi( SolverContext& context, libMesh::Real deltat );
+
+    //! Recompute time steps [begin,end) from the snapshot of begin
+    /*! Leaves the system ready to assemble time step end-1, i.e. at the
+        solution of end but with the old solution and time of end-1. */
+    void recompute_adjoint_states( SolverContext& context,
+                                   unsigned int begin,
+                                   unsigned int end ) const;
+
+    //! Adjoint of time steps [begin,end) in reverse, with n_free snapshots to spare
+    void reverse_adjoint_steps( SolverContext& context,
+                                unsigned int begin,
+                                unsigned int end,
+                                unsigned int n_free,
+                                AdjointSweep& sweep ) const;
+
+    //! Adjoint of the time step ending with state timestep
+    void adjoint_step( SolverContext& context,
+                       unsigned int timestep,
+                       AdjointSweep& sweep ) const;
+
+    //! Add the parameter sensitivities of the time step ending with state timestep
+    void accumulate_adjoint_sensitivities( SolverContext& context,
+                                           unsigned int timestep,
+                                           libMesh::Real qoi_weight,
+                                           AdjointSweep& sweep ) const;
   };
 
   template <typename T>
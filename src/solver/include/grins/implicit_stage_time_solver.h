@@ -0,0 +1,215 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_IMPLICIT_STAGE_TIME_SOLVER_H
+#define GRINS_IMPLICIT_STAGE_TIME_SOLVER_H
+
+// C++
+#include <ostream>
+
+// libMesh
+#include "libmesh/first_order_unsteady_solver.h"
+#include "libmesh/system_norm.h"
+
+class GetPot;
+
+namespace libMesh
+{
+  class DifferentiablePhysics;
+}
+
+namespace GRINS
+{
+  //! Base class for time solvers built from implicit stages
+  /*!
+    Each step consists of one or more stages in which we solve
+
+    \f$ M(U)\dot{U} + F(U,t) = 0, \quad \dot{U} = \sigma (U - Z) \f$
+
+    for the stage solution U at \f$ t = t_n + c\Delta t \f$, given the shift
+    \f$ \sigma \f$ and the offset Z which the subclass builds from previous
+    steps or stages. The mass_residual terms see \f$ \dot{U} \f$ as the
+    solution rate and the time derivative and constraint terms are fully
+    implicit in U.
+
+    The subclass also provides a local error estimate of each step, so
+    adaptive time stepping needs no extra solves, unlike
+    libMesh::TwostepTimeSolver. The step size control follows
+    libMesh::AdaptiveTimeSolver: the error per unit time relative to the
+    solution norm is compared against target_tolerance, steps exceeding
+    upper_tolerance are rejected and retried, and the step size grows by
+    at most max_growth.
+
+    Only systems that are first order in time are supported.
+   */
+  class ImplicitStageTimeSolver : public libMesh::FirstOrderUnsteadySolver
+  {
+  public:
+
+    ImplicitStageTimeSolver( sys_type& system );
+    virtual ~ImplicitStageTimeSolver();
+
+    virtual void init();
+
+    virtual void reinit();
+
+    //! Take a step, retrying with smaller steps on failed solves or too large errors
+    virtual void solve();
+
+    //! Advances the time by the step actually taken in the last solve
+    virtual void advance_timestep();
+
+    //! Start over from the current solution and time, forgetting the step history
+    virtual void restart();
+
+    //! Write the step history that isn't kept in system vectors
+    /*! As "name = value" lines for the checkpoint info file. The system
+        vectors themselves are checkpointed with the rest of the system. */
+    virtual void write_checkpoint_info( std::ostream& /*info*/ ) const {}
+
+    //! Restore the step history written by write_checkpoint_info()
+    /*! Missing entries leave the solver to start up cold. */
+    virtual void read_checkpoint_info( const GetPot& /*info*/ ) {}
+
+    virtual bool element_residual( bool request_jacobian,
+                                   libMesh::DiffContext& context );
+
+    virtual bool side_residual( bool request_jacobian,
+                                libMesh::DiffContext& context );
+
+    virtual bool nonlocal_residual( bool request_jacobian,
+                                    libMesh::DiffContext& context );
+
+    //! Relative error of the last step, or -1 if none was estimated
+    libMesh::Real last_error_estimate() const
+    { return _last_error; }
+
+    //! Nonlinear iterations of all stages solved in the last solve()
+    unsigned int step_nonlinear_iterations() const
+    { return _step_nonlinear_iterations; }
+
+    //! Linear iterations of all stages solved in the last solve()
+    unsigned int step_linear_iterations() const
+    { return _step_linear_iterations; }
+
+    //! DiffSolver results of all stages solved in the last solve(), or'ed together
+    unsigned int step_solve_result() const
+    { return _step_solve_result; }
+
+    //! Adapt the step size if positive
+    libMesh::Real target_tolerance;
+
+    //! Reject steps whose relative error is larger than this, if positive
+    libMesh::Real upper_tolerance;
+
+    //! Largest factor to grow the step size by
+    libMesh::Real max_growth;
+
+    //! Norm for the local error estimate
+    libMesh::SystemNorm component_norm;
+
+    //! Compare the residual of the current solution with the last one before the next step
+    /*! Set by SolutionPredictor, as the residual of the current
+        solution is only meaningful once the first stage is set up. */
+    bool check_initial_guess;
+
+    //! Return from solve() after a failed nonlinear solve
+    /*! Instead of retrying with a smaller step, leave the failed step
+        to an outside controller, e.g. IterationTimeStepController,
+        which sees it through step_solve_result(). */
+    bool return_on_diffsolver_failure;
+
+  protected:
+
+    typedef bool (libMesh::DifferentiablePhysics::*ResFuncType)( bool, libMesh::DiffContext& );
+
+    typedef void (libMesh::DiffContext::*ReinitFuncType)( libMesh::Real );
+
+    //! Solve all stages of a step of size _system.deltat from _old_nonlinear_solution
+    /*! Leaves the new solution in _system.solution and returns the
+        DiffSolver result of the last stage solved. */
+    virtual unsigned int take_step() = 0;
+
+    //! Local error estimate of the step just taken
+    /*! Returns false if there is none, e.g. during start up. */
+    virtual bool compute_error_estimate( libMesh::NumericVector<libMesh::Number>& error ) = 0;
+
+    //! Order in \f$ \Delta t \f$ of the error estimate per unit time
+    virtual unsigned int error_estimate_order() const = 0;
+
+    //! Update any step history before the last step is accepted in advance_timestep()
+    virtual void accept_step() {}
+
+    //! Factor to multiply the step size with given the relative error of the last step
+    virtual libMesh::Real step_size_factor( libMesh::Real relative_error, bool step_accepted );
+
+    //! Step size factor for an error estimate of the given order
+    libMesh::Real order_step_size_factor( libMesh::Real relative_error, unsigned int order ) const;
+
+    //! Error per unit time relative to the solution norm
+    libMesh::Real relative_error( const libMesh::NumericVector<libMesh::Number>& error ) const;
+
+    //! The offset Z of the next stage, to be set before solve_stage()
+    libMesh::NumericVector<libMesh::Number>& stage_offset();
+
+    //! Solve for the stage solution with the current stage_offset()
+    unsigned int solve_stage( libMesh::Real shift, libMesh::Real stage_time );
+
+    //! Whether a DiffSolver result means the solve failed
+    static bool diverged( unsigned int solve_result );
+
+    bool is_adaptive() const
+    { return target_tolerance > 0; }
+
+    bool _general_residual( bool request_jacobian,
+                            libMesh::DiffContext& context,
+                            ResFuncType mass,
+                            ResFuncType time_deriv,
+                            ResFuncType constraint,
+                            ReinitFuncType reinit_func );
+
+    //! Size and ghost _local_stage_offset for the current dof distribution
+    void init_local_stage_offset();
+
+    //! Stage offset with the ghost entries needed for assembly
+    libMesh::UniquePtr<libMesh::NumericVector<libMesh::Number> > _local_stage_offset;
+
+    //! Shift and time, as a fraction of the step, of the current stage
+    libMesh::Real _shift;
+    libMesh::Real _stage_time;
+
+    //! The step size of the last solve, as _system.deltat may already be the next one
+    libMesh::Real _last_deltat;
+
+    libMesh::Real _last_error;
+
+    unsigned int _step_nonlinear_iterations;
+    unsigned int _step_linear_iterations;
+    unsigned int _step_solve_result;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_IMPLICIT_STAGE_TIME_SOLVER_H
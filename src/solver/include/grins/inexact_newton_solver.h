@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_INEXACT_NEWTON_SOLVER_H
+#define GRINS_INEXACT_NEWTON_SOLVER_H
+
+// C++
+#include <utility>
+
+// libMesh
+#include "libmesh/diff_solver.h"
+#include "libmesh/linear_solver.h"
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! Newton solver that can reuse the assembled matrix across iterations
+  /*!
+    Inexact Newton's method with the tolerances, linear tolerance heuristic
+    and residual-reduction backtracking of libMesh::NewtonSolver. In
+    addition, the assembled system matrix may be lagged: it is only
+    reassembled every matrix_lag+1 Newton iterations, counting across
+    solves (i.e. time steps). Since the matrix doesn't change in between,
+    the linear solver reuses its preconditioner (e.g. an ILU factorization)
+    too. The matrix is reassembled early when the nonlinear residual drops
+    by less than lag_refresh_ratio in an iteration, and a step
+    that doesn't reduce the residual with a lagged matrix is retried with
+    a fresh one before backtracking.
+
+    The linear tolerance (forcing term) is either chosen with the
+    libMesh::NewtonSolver heuristic or by one of the Eisenstat-Walker
+    choices, see forcing_term.
+
+    Subclasses may change how the matrix is used, see JFNKSolver.
+   */
+  class InexactNewtonSolver : public libMesh::DiffSolver
+  {
+  public:
+
+    //! Strategy for the linear tolerance of each Newton iteration
+    /*! FIXED_FORCING_TERM is the libMesh::NewtonSolver heuristic,
+        EISENSTAT_WALKER_1/2 are choices 1 and 2 of Eisenstat and
+        Walker, SIAM J. Sci. Comput. 17 (1996). */
+    enum ForcingTerm { FIXED_FORCING_TERM = 0,
+                       EISENSTAT_WALKER_1,
+                       EISENSTAT_WALKER_2 };
+
+    InexactNewtonSolver( MultiphysicsSystem& system );
+    virtual ~InexactNewtonSolver();
+
+    virtual void init();
+
+    virtual void reinit();
+
+    virtual unsigned int solve();
+
+    //! Backtrack the Newton step until the residual decreases
+    bool require_residual_reduction;
+
+    //! Give up backtracking below this fraction of the Newton step
+    libMesh::Real minsteplength;
+
+    //! Number of Newton iterations after the first to reuse the assembled matrix for
+    unsigned int matrix_lag;
+
+    //! Reassemble a lagged matrix when the residual drops by less than this factor
+    libMesh::Real lag_refresh_ratio;
+
+    //! Linear tolerance strategy, FIXED_FORCING_TERM by default
+    ForcingTerm forcing_term;
+
+    //! Eisenstat-Walker gamma, only used by EISENSTAT_WALKER_2
+    libMesh::Real forcing_gamma;
+
+    //! Eisenstat-Walker exponent alpha
+    libMesh::Real forcing_alpha;
+
+    //! Upper bound on Eisenstat-Walker forcing terms
+    libMesh::Real max_forcing_term;
+
+    //! Lower bound on Eisenstat-Walker forcing terms
+    libMesh::Real min_forcing_term;
+
+    //! Nonlinear residual norm at the start of the last solve
+    libMesh::Real initial_residual() const
+    { return _initial_residual; }
+
+    //! Nonlinear residual norm at the end of the last solve
+    libMesh::Real final_residual() const
+    { return _final_residual; }
+
+  protected:
+
+    //! Assemble the residual into residual and return its norm
+    virtual libMesh::Real assemble_residual( libMesh::NumericVector<libMesh::Number>& residual );
+
+    //! Assemble the system matrix
+    virtual void assemble_matrix();
+
+    //! Solve for the Newton step, returning the linear iterations and final residual
+    virtual std::pair<unsigned int, libMesh::Real>
+    linear_solve( libMesh::NumericVector<libMesh::Number>& step,
+                  libMesh::NumericVector<libMesh::Number>& residual,
+                  libMesh::Real tolerance );
+
+    //! Norm of residual - A*step for the operator A linear_solve() used
+    /*! Unlike the residual reported by the Krylov solver, this doesn't
+        depend on the preconditioner. Costs one matrix-vector product. */
+    virtual libMesh::Real linear_residual_norm( const libMesh::NumericVector<libMesh::Number>& step,
+                                                const libMesh::NumericVector<libMesh::Number>& residual );
+
+    //! Eisenstat-Walker forcing term for the next linear solve
+    /*! current_residual and last_residual are the nonlinear residual
+        norms of this and the previous iterate, last_linear_residual the
+        true (unpreconditioned) residual norm of the previous linear
+        solve, see linear_residual_norm(), and last_forcing_term the
+        tolerance it was solved to. */
+    libMesh::Real eisenstat_walker_forcing_term( libMesh::Real current_residual,
+                                                 libMesh::Real last_residual,
+                                                 libMesh::Real last_linear_residual,
+                                                 libMesh::Real last_forcing_term ) const;
+
+    //! Set _solve_result and return true if we're converged
+    bool test_convergence( libMesh::Real current_residual,
+                           libMesh::Real step_norm,
+                           bool check_step );
+
+    MultiphysicsSystem& _multiphysics_system;
+
+    libMesh::UniquePtr<libMesh::LinearSolver<libMesh::Number> > _linear_solver;
+
+    //! Number of Newton iterations the current matrix has been used for
+    unsigned int _matrix_age;
+
+    //! Reassemble the matrix at the next iteration regardless of matrix_lag
+    bool _refresh_matrix;
+
+    libMesh::Real _initial_residual;
+
+    libMesh::Real _final_residual;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_INEXACT_NEWTON_SOLVER_H
@@ -0,0 +1,94 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_ITERATION_TIME_STEP_CONTROLLER_H
+#define GRINS_ITERATION_TIME_STEP_CONTROLLER_H
+
+// GRINS
+#include "grins/iteration_time_stepping_options.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class DifferentiableSystem;
+}
+
+namespace GRINS
+{
+  //! Chooses deltat from how hard the nonlinear solves were
+  /*!
+    Unlike the error estimate based adaptive time stepping, this needs no
+    extra solves: after each time step deltat is scaled by the smallest of
+
+    - target_nonlinear_iterations / Newton iterations,
+    - target_linear_iterations / Krylov iterations per Newton iteration,
+    - target_contraction / average residual reduction per Newton iteration,
+
+    limited to [min_growth, max_growth] and [min_deltat, max_deltat]. The
+    residual reduction is only available with the InexactNewtonSolver
+    based nonlinear solvers. Steps whose solve failed, or took more than
+    reject_nonlinear_iterations Newton iterations, are rejected and retried
+    with deltat scaled by rejection_factor.
+
+    With the BDF and ESDIRK solvers the iterations of all stages of a
+    step count, and their failed solves are left to this controller.
+
+    This controls throughput, not temporal accuracy.
+   */
+  class IterationTimeStepController
+  {
+  public:
+
+    IterationTimeStepController( const IterationTimeSteppingOptions& options );
+
+    ~IterationTimeStepController(){};
+
+    //! Judge the last solve, reducing deltat for the retry if it's rejected
+    bool accept_step( libMesh::DifferentiableSystem& system );
+
+    //! Set deltat for the next step, once the accepted one has been advanced
+    void update_deltat( libMesh::DifferentiableSystem& system );
+
+    void print_statistics() const;
+
+  private:
+
+    IterationTimeSteppingOptions _options;
+
+    libMesh::Real _next_deltat;
+
+    unsigned int _n_accepted;
+    unsigned int _n_rejected;
+
+    unsigned int _total_nonlinear_iterations;
+    unsigned int _total_linear_iterations;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_ITERATION_TIME_STEP_CONTROLLER_H
@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_JFNK_SOLVER_H
+#define GRINS_JFNK_SOLVER_H
+
+// GRINS
+#include "grins/inexact_newton_solver.h"
+
+namespace GRINS
+{
+  //! Jacobian-free Newton-Krylov nonlinear solver
+  /*!
+    Newton's method where the Krylov solver applies the Jacobian through
+    finite differences of the residual,
+    \f$ J(u)v \approx (R(u+\epsilon v) - R(u))/\epsilon \f$,
+    so the true Jacobian is never assembled or stored. The system matrix
+    is only used as the preconditioner, and is assembled from the Physics
+    terms selected with Physics/<physics_name>/jfnk_terms. Selected with
+    linear-nonlinear-solver/nonlinear_solver = jfnk.
+
+    Lagging the matrix (see InexactNewtonSolver) lags the preconditioner.
+   */
+  class JFNKSolver : public InexactNewtonSolver
+  {
+  public:
+
+    JFNKSolver( MultiphysicsSystem& system );
+    virtual ~JFNKSolver();
+
+    virtual unsigned int solve();
+
+    //! Finite difference step, relative to the size of the solution, for Jacobian-vector products
+    libMesh::Real fd_step;
+
+  protected:
+
+    //! Residual without preconditioner only terms
+    virtual libMesh::Real assemble_residual( libMesh::NumericVector<libMesh::Number>& residual );
+
+    //! Preconditioner from the Jacobian of the terms not flagged residual only
+    virtual void assemble_matrix();
+
+    //! Krylov solve with finite difference Jacobian-vector products
+    virtual std::pair<unsigned int, libMesh::Real>
+    linear_solve( libMesh::NumericVector<libMesh::Number>& step,
+                  libMesh::NumericVector<libMesh::Number>& residual,
+                  libMesh::Real tolerance );
+
+    //! Applies the finite difference Jacobian, i.e. one residual evaluation
+    virtual libMesh::Real linear_residual_norm( const libMesh::NumericVector<libMesh::Number>& step,
+                                                const libMesh::NumericVector<libMesh::Number>& residual );
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_JFNK_SOLVER_H
@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PARAREAL_DRIVER_H
+#define GRINS_PARAREAL_DRIVER_H
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel.h"
+
+// libMesh forward declarations
+class GetPot;
+namespace libMesh
+{
+  template <typename T> class NumericVector;
+}
+
+namespace GRINS
+{
+  // Forward declarations
+  class Simulation;
+
+  //! Parareal parallel-in-time integration of an unsteady Simulation
+  /*!
+    The processors are split into SolverOptions/Parareal/n_time_slices
+    equally sized groups, each of which builds the whole Simulation and
+    integrates one time slice of the n_timesteps*delta_t time interval
+    from SolverOptions/TimeStepping. On each slice the fine propagator
+    is the configured UnsteadySolver with n_timesteps/n_time_slices
+    steps and the coarse propagator is the same solver with
+    SolverOptions/Parareal/coarse_timesteps_per_slice larger steps. The
+    states at the slice interfaces are corrected with
+
+    \f$ U^{n+1}_{k+1} = G(U^n_{k+1}) + F(U^n_k) - G(U^n_k) \f$
+
+    until their relative change is below SolverOptions/Parareal/tolerance
+    or after SolverOptions/Parareal/max_iterations iterations. After
+    n_time_slices iterations every slice has started from the fine
+    solution, so no more are ever needed. States are
+    passed between slices processor by processor, so every slice must
+    end up with the same mesh partitioning.
+
+    Only the state at the end of each slice is output, to files whose
+    prefix is vis-options/vis_output_file_prefix followed by _slice and
+    the slice number.
+   */
+  class PararealDriver
+  {
+  public:
+
+    PararealDriver( const GetPot& input,
+                    const libMesh::Parallel::Communicator& comm );
+
+    ~PararealDriver(){};
+
+    //! Whether the input asks for more than one time slice
+    static bool is_enabled( const GetPot& input );
+
+    //! The processors of our time slice, to build its Simulation with
+    const libMesh::Parallel::Communicator& space_communicator() const
+    { return _space_comm; }
+
+    //! Integrate our time slice of simulation, built with space_communicator()
+    void run( Simulation& simulation );
+
+  private:
+
+    //! Our local entries of solution go to the same processor of the next slice
+    void send_to_next_slice( const libMesh::NumericVector<libMesh::Number>& solution );
+
+    void receive_from_previous_slice( libMesh::NumericVector<libMesh::Number>& solution );
+
+    unsigned int _n_slices;
+
+    //! Our time slice
+    unsigned int _slice;
+
+    unsigned int _n_timesteps;
+
+    libMesh::Real _deltat;
+
+    unsigned int _n_coarse_timesteps;
+
+    unsigned int _max_iterations;
+
+    libMesh::Real _tolerance;
+
+    //! Processors of our time slice
+    libMesh::Parallel::Communicator _space_comm;
+
+    //! Processors with our rank in _space_comm, ranked by time slice
+    libMesh::Parallel::Communicator _time_comm;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_PARAREAL_DRIVER_H
@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PSEUDO_TRANSIENT_TIME_SOLVER_H
+#define GRINS_PSEUDO_TRANSIENT_TIME_SOLVER_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/pseudo_transient_options.h"
+
+// libMesh
+#include "libmesh/first_order_unsteady_solver.h"
+
+namespace libMesh
+{
+  class DifferentiablePhysics;
+}
+
+namespace GRINS
+{
+  //! Time solver for pseudo-transient continuation of steady problems
+  /*!
+    While pseudo time stepping is active, each solve takes a backward
+    Euler step
+
+    \f$ M(U)\frac{U - U_{old}}{\Delta\tau} + F(U) = 0 \f$
+
+    with the mass_residual terms of the physics, and with \f$ \Delta\tau \f$
+    either the system deltat or, with local pseudo time steps, computed per
+    element from the CFL number and the velocity. Scalar variables get no
+    pseudo time term with local pseudo time steps. The time is never
+    advanced, so the physics see a steady problem. Otherwise each solve is
+    a plain steady solve, as with libMesh::SteadySolver.
+   */
+  class PseudoTransientTimeSolver : public libMesh::FirstOrderUnsteadySolver
+  {
+  public:
+
+    PseudoTransientTimeSolver( sys_type& system, const PseudoTransientOptions& options );
+    virtual ~PseudoTransientTimeSolver();
+
+    virtual void init();
+
+    virtual void solve();
+
+    //! Make the current solution the old one of the next pseudo time step
+    virtual void advance_timestep();
+
+    //! Time accurate, or not, only while pseudo time stepping
+    virtual bool is_steady() const
+    { return !pseudo_time; }
+
+    virtual libMesh::Real error_order() const
+    { return 1.; }
+
+    virtual bool element_residual( bool request_jacobian,
+                                   libMesh::DiffContext& context );
+
+    virtual bool side_residual( bool request_jacobian,
+                                libMesh::DiffContext& context );
+
+    virtual bool nonlocal_residual( bool request_jacobian,
+                                    libMesh::DiffContext& context );
+
+    //! Norm of the residual of the steady problem at the current solution
+    libMesh::Real steady_residual_norm();
+
+    //! Whether to add the pseudo time term
+    bool pseudo_time;
+
+    //! CFL number of the local pseudo time steps
+    libMesh::Real cfl;
+
+  protected:
+
+    typedef bool (libMesh::DifferentiablePhysics::*ResFuncType)( bool, libMesh::DiffContext& );
+
+    //! Pseudo time step of the element of context, 0 for none
+    libMesh::Real local_deltat( const libMesh::DiffContext& context, bool on_elem ) const;
+
+    bool _general_residual( bool request_jacobian,
+                            libMesh::DiffContext& context,
+                            bool on_elem,
+                            ResFuncType mass,
+                            ResFuncType time_deriv,
+                            ResFuncType constraint );
+
+    PseudoTransientOptions _options;
+
+    std::vector<unsigned int> _velocity_vars;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_PSEUDO_TRANSIENT_TIME_SOLVER_H
@@ -40,6 +40,7 @@
 #include "grins/postprocessed_quantities.h"
 #include "grins/error_estimator_options.h"
 #include "grins/qoi_output.h"
+#include "grins/checkpointer.h"
 
 // libMesh
 #include "libmesh/error_estimator.h"
@@ -61,6 +62,7 @@ namespace GRINS
   // Forward declarations
   class SimulationBuilder;
   class MultiphysicsSystem;
+  class SolverContext;
 
   class Simulation
   {
@@ -83,6 +85,11 @@ namespace GRINS
 
     void print_sim_info();
 
+    //! Fill in context for running our solver
+    void build_solver_context( SolverContext& context );
+
+    SharedPtr<GRINS::Solver> get_solver();
+
     SharedPtr<libMesh::EquationSystems> get_equation_system();
     MultiphysicsSystem* get_multiphysics_system();
 
@@ -172,6 +179,8 @@ namespace GRINS
 
     bool _have_restart;
 
+    SharedPtr<Checkpointer> _checkpointer;
+
   private:
 
     Simulation();
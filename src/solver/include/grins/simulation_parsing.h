@@ -47,10 +47,19 @@ namespace GRINS
     static std::string restart_file( const GetPot& input )
     { return input( SimulationParsing::restart_input_option(), "none" ); }
 
+    static bool have_checkpoint_restart( const GetPot& input )
+    { return input.have_variable( SimulationParsing::restart_checkpoint_input_option() ); }
+
+    static std::string restart_checkpoint( const GetPot& input )
+    { return input( SimulationParsing::restart_checkpoint_input_option(), "none" ); }
+
   private:
 
     static std::string restart_input_option()
     { return "restart-options/restart_file"; }
+
+    static std::string restart_checkpoint_input_option()
+    { return "restart-options/restart_checkpoint"; }
   };
 
 } // end namespace GRINS
@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_SOLUTION_PREDICTOR_H
+#define GRINS_SOLUTION_PREDICTOR_H
+
+// C++
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class DifferentiableSystem;
+  template <typename T> class NumericVector;
+}
+
+namespace GRINS
+{
+  //! Initial guess for each time step extrapolated from previous time steps
+  /*!
+    Extrapolates the polynomial through the solutions of the last order+1
+    time steps, at the times they were computed at, to the end of the next
+    time step, so varying time step sizes are accounted for. The prediction
+    is only kept if its residual is smaller than that of the previous
+    solution, which costs two residual assemblies per time step.
+
+    Until enough time steps have been taken, the order is reduced
+    accordingly. Enabled with SolverOptions/TimeStepping/predictor_order > 0.
+   */
+  class SolutionPredictor
+  {
+  public:
+
+    SolutionPredictor( unsigned int order );
+
+    ~SolutionPredictor(){};
+
+    //! Record the solution at the current time, after the time step was advanced
+    void store( libMesh::DifferentiableSystem& system );
+
+    //! Replace the solution by its extrapolation to the end of the next time step
+    /*! Does nothing until two time steps have been stored. */
+    void predict( libMesh::DifferentiableSystem& system );
+
+    //! Swap the solution with fallback if fallback has the smaller residual
+    /*! Returns whether the original solution was kept. */
+    static bool keep_better_guess( libMesh::DifferentiableSystem& system,
+                                   const libMesh::NumericVector<libMesh::Number>& fallback );
+
+  private:
+
+    static libMesh::Real residual_norm( libMesh::DifferentiableSystem& system );
+
+    unsigned int _order;
+
+    //! Names of the vectors with the stored solutions, newest first
+    std::vector<std::string> _history_names;
+
+    std::vector<libMesh::Real> _history_times;
+
+    unsigned int _n_history;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_SOLUTION_PREDICTOR_H
@@ -33,6 +33,7 @@
 #include "grins/visualization.h"
 #include "grins/postprocessed_quantities.h"
 #include "grins/qoi_output.h"
+#include "grins/checkpointer.h"
 
 // libMesh
 #include "libmesh/error_estimator.h"
@@ -77,6 +78,9 @@ namespace GRINS
 
     bool have_restart;
 
+    //! Writes checkpoints of unsteady runs, see Checkpointer
+    SharedPtr<Checkpointer> checkpointer;
+
   };
 
 } // end namespace GRINS
@@ -52,5 +52,11 @@ namespace GRINS
     static const std::string libmesh_newmark_solver()
     { return "libmesh_newmark"; }
 
+    static const std::string grins_bdf_solver()
+    { return "grins_bdf_solver"; }
+
+    static const std::string grins_esdirk_solver()
+    { return "grins_esdirk_solver"; }
+
   };
 } // end namespace GRINS
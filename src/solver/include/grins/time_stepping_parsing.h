@@ -56,6 +56,16 @@ namespace GRINS
     static double parse_deltat( const GetPot& input );
 
     static std::string parse_time_stepper_name( const GetPot& input );
+
+    //! Parse the highest order for BDFSolver, between 1 and 5. Defaults to 2.
+    static unsigned int parse_bdf_max_order( const GetPot& input );
+
+    //! Parse the Runge-Kutta scheme for ESDIRKSolver. Defaults to esdirk3.
+    static std::string parse_esdirk_scheme( const GetPot& input );
+
+    //! Parse the order of the polynomial extrapolating the initial guess of each time step
+    /*! Defaults to 0, meaning each time step starts from the previous solution. */
+    static unsigned int parse_predictor_order( const GetPot& input );
   };
 
 } // end namespace GRINS
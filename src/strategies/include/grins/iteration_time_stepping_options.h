@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_ITERATION_TIME_STEPPING_OPTIONS_H
+#define GRINS_ITERATION_TIME_STEPPING_OPTIONS_H
+
+// libmMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! Container for time step control options based on solver iteration counts
+  /*!
+    Parsed from Strategies/IterationTimeStepping. Setting
+    target_nonlinear_iterations enables the controller.
+   */
+  class IterationTimeSteppingOptions
+  {
+  public:
+    IterationTimeSteppingOptions( const GetPot& input );
+    ~IterationTimeSteppingOptions(){};
+
+    bool is_time_adaptive() const
+    { return _target_nonlinear_iterations > 0; }
+
+    //! Newton iterations per time step to aim for
+    double target_nonlinear_iterations() const
+    { return _target_nonlinear_iterations; }
+
+    //! Krylov iterations per Newton iteration to aim for, 0 to ignore them
+    double target_linear_iterations() const
+    { return _target_linear_iterations; }
+
+    //! Average residual reduction per Newton iteration to aim for, 0 to ignore it
+    double target_contraction() const
+    { return _target_contraction; }
+
+    //! Largest factor to grow deltat by after an accepted step
+    double max_growth() const
+    { return _max_growth; }
+
+    //! Smallest factor to shrink deltat by after an accepted step
+    double min_growth() const
+    { return _min_growth; }
+
+    //! Factor to shrink deltat by when retrying a rejected step
+    double rejection_factor() const
+    { return _rejection_factor; }
+
+    //! Reject steps taking more Newton iterations than this, 0 to only reject failed solves
+    unsigned int reject_nonlinear_iterations() const
+    { return _reject_nonlinear_iterations; }
+
+    double min_deltat() const
+    { return _min_deltat; }
+
+    //! 0 means no upper bound
+    double max_deltat() const
+    { return _max_deltat; }
+
+  private:
+
+    double _target_nonlinear_iterations;
+    double _target_linear_iterations;
+    double _target_contraction;
+    double _max_growth;
+    double _min_growth;
+    double _rejection_factor;
+    unsigned int _reject_nonlinear_iterations;
+    double _min_deltat;
+    double _max_deltat;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_ITERATION_TIME_STEPPING_OPTIONS_H
@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PSEUDO_TRANSIENT_OPTIONS_H
+#define GRINS_PSEUDO_TRANSIENT_OPTIONS_H
+
+// C++
+#include <string>
+#include <vector>
+
+// libmMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! Container for pseudo-transient continuation options of the steady solver
+  /*!
+    Parsed from Strategies/PseudoTransient. Setting initial_deltat enables
+    continuation with one pseudo time step for the whole mesh, setting
+    initial_cfl enables it with element-local pseudo time steps
+    \f$ \Delta\tau_e = CFL\, h_e / (|u_e| + c) \f$, with \f$ u_e \f$ the
+    velocity_variables at the element centroid and c the reference_speed.
+   */
+  class PseudoTransientOptions
+  {
+  public:
+    PseudoTransientOptions( const GetPot& input );
+    ~PseudoTransientOptions(){};
+
+    bool is_enabled() const
+    { return _initial_deltat > 0 || _initial_cfl > 0; }
+
+    bool local_deltat() const
+    { return _initial_cfl > 0; }
+
+    double initial_deltat() const
+    { return _initial_deltat; }
+
+    //! 0 means no upper bound
+    double max_deltat() const
+    { return _max_deltat; }
+
+    double initial_cfl() const
+    { return _initial_cfl; }
+
+    //! 0 means no upper bound
+    double max_cfl() const
+    { return _max_cfl; }
+
+    //! Variables making up the velocity for the local pseudo time steps
+    const std::vector<std::string>& velocity_variables() const
+    { return _velocity_variables; }
+
+    //! Added to the velocity magnitude, e.g. a sound speed
+    double reference_speed() const
+    { return _reference_speed; }
+
+    //! Largest factor to grow the pseudo time step by
+    double max_growth() const
+    { return _max_growth; }
+
+    //! Smallest factor to shrink the pseudo time step by
+    double min_growth() const
+    { return _min_growth; }
+
+    //! Factor to shrink the pseudo time step by after a rejected step
+    double rejection_factor() const
+    { return _rejection_factor; }
+
+    //! Switch to Newton's method once the steady residual is reduced by this factor
+    double newton_tolerance() const
+    { return _newton_tolerance; }
+
+    unsigned int max_steps() const
+    { return _max_steps; }
+
+    //! Newton iterations to take on each pseudo time step
+    unsigned int nonlinear_iterations_per_step() const
+    { return _nonlinear_iterations_per_step; }
+
+  private:
+
+    double _initial_deltat;
+    double _max_deltat;
+    double _initial_cfl;
+    double _max_cfl;
+    std::vector<std::string> _velocity_variables;
+    double _reference_speed;
+    double _max_growth;
+    double _min_growth;
+    double _rejection_factor;
+    double _newton_tolerance;
+    unsigned int _max_steps;
+    unsigned int _nonlinear_iterations_per_step;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_PSEUDO_TRANSIENT_OPTIONS_H
@@ -0,0 +1,74 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_UNSTEADY_ADJOINT_OPTIONS_H
+#define GRINS_UNSTEADY_ADJOINT_OPTIONS_H
+
+// C++
+#include <string>
+
+// libmMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! Container for options of adjoint solves of unsteady problems
+  /*!
+    Parsed from Strategies/UnsteadyAdjoint.
+   */
+  class UnsteadyAdjointOptions
+  {
+  public:
+    UnsteadyAdjointOptions( const GetPot& input );
+    ~UnsteadyAdjointOptions(){};
+
+    //! Forward states kept in memory for the reverse sweep
+    unsigned int n_memory_snapshots() const
+    { return _n_memory_snapshots; }
+
+    //! Forward states written to disk once the memory snapshots are used up
+    unsigned int n_disk_snapshots() const
+    { return _n_disk_snapshots; }
+
+    //! Directory for the disk snapshots
+    const std::string& snapshot_directory() const
+    { return _snapshot_directory; }
+
+    //! Whether the QoIs are integrated over time instead of taken at the final time
+    /*! This also applies to the QoI values UnsteadySolver outputs. */
+    bool time_integrated_qoi() const
+    { return _time_integrated_qoi; }
+
+  private:
+
+    unsigned int _n_memory_snapshots;
+    unsigned int _n_disk_snapshots;
+    std::string _snapshot_directory;
+    bool _time_integrated_qoi;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_UNSTEADY_ADJOINT_OPTIONS_H
@@ -67,6 +67,8 @@ namespace GRINS
 			   OMEGA_DOT,
                            VELOCITY_PENALTY,
                            VELOCITY_PENALTY_BASE,
+                           //! Not a quantity: number of CachedQuantities, used to size storage
+                           N_CACHED_QUANTITIES
                            };
   } // namespace Cache
 } // namespace GRINS
@@ -29,7 +29,6 @@
 //C++
 #include <set>
 #include <vector>
-#include <map>
 
 // libMesh
 #include "libmesh/libmesh.h"
@@ -40,6 +39,24 @@
 
 namespace GRINS
 {
+  //! Per-element storage of quantities shared between Physics
+  /*!
+    Storage is indexed directly by Cache::CachedQuantities. Each quantity
+    owns its own slab which is sized to the number of quadrature points
+    (and the number of components, e.g. species, for vector quantities).
+    clear() only invalidates the slabs, it does not release their memory,
+    so a CachedValues object that is reused across elements (as is done
+    through AssemblyContext) does not allocate once the slabs have reached
+    their steady state size.
+
+    Physics should prefer the get_writable_* methods, which hand back
+    the slab for in-place filling, over the set_* methods, which copy.
+
+    Note that the outer (quadrature point) dimension of the vector quantities
+    is never shrunk, so that the per-component storage survives switching
+    between element interiors and sides. Only the first n_qpoints entries
+    are valid for the current element.
+   */
   class CachedValues
   {
   public:
@@ -51,20 +68,39 @@ namespace GRINS
 
     void add_quantities( const std::set<unsigned int>& cache_list );
 
+    //! Invalidate all cached values. Storage is kept for reuse.
     void clear();
 
-    bool is_active(unsigned int quantity);
+    bool is_active(unsigned int quantity) const;
 
-    void set_values( unsigned int quantity, std::vector<libMesh::Number>& values );
+    //! Slab for quantity, resized to n_qpoints. Values are to be filled in place.
+    std::vector<libMesh::Number>& get_writable_values( unsigned int quantity,
+                                                       unsigned int n_qpoints );
+
+    //! Slab for quantity, resized to n_qpoints. Values are to be filled in place.
+    std::vector<libMesh::Gradient>& get_writable_gradient_values( unsigned int quantity,
+                                                                  unsigned int n_qpoints );
+
+    //! Slab for quantity, resized to n_qpoints x n_components. Values are to be filled in place.
+    std::vector<std::vector<libMesh::Number> >& get_writable_vector_values( unsigned int quantity,
+                                                                            unsigned int n_qpoints,
+                                                                            unsigned int n_components );
+
+    //! Slab for quantity, resized to n_qpoints x n_components. Values are to be filled in place.
+    std::vector<std::vector<libMesh::Gradient> >& get_writable_vector_gradient_values( unsigned int quantity,
+                                                                                       unsigned int n_qpoints,
+                                                                                       unsigned int n_components );
+
+    void set_values( unsigned int quantity, const std::vector<libMesh::Number>& values );
 
     void set_gradient_values( unsigned int quantity,
-			      std::vector<libMesh::Gradient>& values );
+			      const std::vector<libMesh::Gradient>& values );
 
     void set_vector_values( unsigned int quantity,
-			    std::vector<std::vector<libMesh::Number> >& values );
+			    const std::vector<std::vector<libMesh::Number> >& values );
 
     void set_vector_gradient_values( unsigned int quantity,
-				     std::vector<std::vector<libMesh::Gradient> >& values );
+				     const std::vector<std::vector<libMesh::Gradient> >& values );
 
     const std::vector<libMesh::Number>& get_cached_values( unsigned int quantity ) const;
     
@@ -77,20 +113,128 @@ namespace GRINS
     unsigned int size() const;
 
   protected:
-    
-    std::set<unsigned int> _cache_list;
 
-    std::map<unsigned int,std::vector<libMesh::Number> > _cached_values;
-    std::map<unsigned int,std::vector<libMesh::Gradient> > _cached_gradient_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Number> >  > _cached_vector_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Gradient> >  > _cached_vector_gradient_values;
+    //! Resize the outer and inner vectors, reusing the inner storage that's already there
+    template<typename T>
+    void resize_vector_slab( std::vector<std::vector<T> >& slab,
+                             unsigned int n_qpoints,
+                             unsigned int n_components );
+
+    //! Whether each quantity has been requested through add_quantity
+    std::vector<bool> _active;
+
+    //! Whether each quantity has been computed since the last clear()
+    std::vector<bool> _computed;
+
+    unsigned int _n_active;
+
+    std::vector<std::vector<libMesh::Number> > _cached_values;
+    std::vector<std::vector<libMesh::Gradient> > _cached_gradient_values;
+    std::vector<std::vector<std::vector<libMesh::Number> > > _cached_vector_values;
+    std::vector<std::vector<std::vector<libMesh::Gradient> > > _cached_vector_gradient_values;
     
   };
 
   inline
   unsigned int CachedValues::size() const
   {
-    return _cache_list.size();
+    return _n_active;
+  }
+
+  inline
+  bool CachedValues::is_active(unsigned int quantity) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    return _active[quantity];
+  }
+
+  inline
+  std::vector<libMesh::Number>& CachedValues::get_writable_values( unsigned int quantity,
+                                                                    unsigned int n_qpoints )
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    _computed[quantity] = true;
+    _cached_values[quantity].resize(n_qpoints);
+    return _cached_values[quantity];
+  }
+
+  inline
+  std::vector<libMesh::Gradient>& CachedValues::get_writable_gradient_values( unsigned int quantity,
+                                                                               unsigned int n_qpoints )
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    _computed[quantity] = true;
+    _cached_gradient_values[quantity].resize(n_qpoints);
+    return _cached_gradient_values[quantity];
+  }
+
+  inline
+  std::vector<std::vector<libMesh::Number> >& CachedValues::get_writable_vector_values( unsigned int quantity,
+                                                                                         unsigned int n_qpoints,
+                                                                                         unsigned int n_components )
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    _computed[quantity] = true;
+    this->resize_vector_slab( _cached_vector_values[quantity], n_qpoints, n_components );
+    return _cached_vector_values[quantity];
+  }
+
+  inline
+  std::vector<std::vector<libMesh::Gradient> >& CachedValues::get_writable_vector_gradient_values( unsigned int quantity,
+                                                                                                    unsigned int n_qpoints,
+                                                                                                    unsigned int n_components )
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    _computed[quantity] = true;
+    this->resize_vector_slab( _cached_vector_gradient_values[quantity], n_qpoints, n_components );
+    return _cached_vector_gradient_values[quantity];
+  }
+
+  inline
+  const std::vector<libMesh::Number>& CachedValues::get_cached_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _computed[quantity] );
+    return _cached_values[quantity];
+  }
+
+  inline
+  const std::vector<libMesh::Gradient>& CachedValues::get_cached_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _computed[quantity] );
+    return _cached_gradient_values[quantity];
+  }
+
+  inline
+  const std::vector<std::vector<libMesh::Number> >& CachedValues::get_cached_vector_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _computed[quantity] );
+    return _cached_vector_values[quantity];
+  }
+
+  inline
+  const std::vector<std::vector<libMesh::Gradient> >& CachedValues::get_cached_vector_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _computed[quantity] );
+    return _cached_vector_gradient_values[quantity];
+  }
+
+  template<typename T>
+  inline
+  void CachedValues::resize_vector_slab( std::vector<std::vector<T> >& slab,
+                                         unsigned int n_qpoints,
+                                         unsigned int n_components )
+  {
+    // Never shrink the outer vector: that would free the inner storage
+    // we want to hang on to for the next element. Only grow it.
+    if( slab.size() < n_qpoints )
+      slab.resize(n_qpoints);
+
+    for( unsigned int qp = 0; qp < n_qpoints; qp++ )
+      slab[qp].resize(n_components);
   }
 
 } // namespace GRINS
@@ -0,0 +1,308 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_DUAL_NUMBER_H
+#define GRINS_DUAL_NUMBER_H
+
+// C++
+#include <cmath>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+//! Maximum number of derivatives a DualNumber can carry
+/*! Under jacobian_mode = ad this bounds the number of degrees of freedom
+    on an element. Define it to a larger value when configuring for
+    elements with more. */
+#ifndef GRINS_DUAL_NUMBER_CAPACITY
+#define GRINS_DUAL_NUMBER_CAPACITY 128
+#endif
+
+namespace GRINS
+{
+  //! Forward-mode automatic differentiation scalar
+  /*!
+    Carries a value together with its derivatives with respect to some set
+    of independent variables, e.g. the degrees of freedom on the current
+    element (see ElementAssembly). A DualNumber without any derivatives is
+    a constant, so mixing DualNumbers with Reals (which convert implicitly)
+    is cheap.
+
+    The derivatives are stored inline, in a buffer of capacity()
+    entries, so that arithmetic in the element assembly loops never
+    touches the heap. Only the n_derivatives() leading entries are ever
+    copied or operated on.
+
+    Templated code that calls math functions should bring the std versions
+    into scope with a using-declaration, e.g. "using std::sqrt;" followed
+    by an unqualified "sqrt(x)", so that the same code is valid for both
+    libMesh::Real and DualNumber.
+   */
+  class DualNumber
+  {
+  public:
+
+    DualNumber()
+      : _value(0.0),
+        _n_derivs(0)
+    {}
+
+    DualNumber( libMesh::Real value )
+      : _value(value),
+        _n_derivs(0)
+    {}
+
+    //! Value with n_derivs (zero) derivatives
+    DualNumber( libMesh::Real value, unsigned int n_derivs )
+      : _value(value),
+        _n_derivs(n_derivs)
+    {
+      libmesh_assert_less_equal( n_derivs, capacity() );
+
+      for( unsigned int i = 0; i < _n_derivs; i++ )
+        _derivs[i] = 0.0;
+    }
+
+    DualNumber( const DualNumber& other )
+      : _value(other._value),
+        _n_derivs(other._n_derivs)
+    {
+      for( unsigned int i = 0; i < _n_derivs; i++ )
+        _derivs[i] = other._derivs[i];
+    }
+
+    DualNumber& operator=( const DualNumber& other )
+    {
+      _value = other._value;
+      _n_derivs = other._n_derivs;
+
+      for( unsigned int i = 0; i < _n_derivs; i++ )
+        _derivs[i] = other._derivs[i];
+
+      return *this;
+    }
+
+    //! Largest number of derivatives a DualNumber can carry
+    static unsigned int capacity()
+    { return GRINS_DUAL_NUMBER_CAPACITY; }
+
+    libMesh::Real value() const
+    { return _value; }
+
+    libMesh::Real& value()
+    { return _value; }
+
+    unsigned int n_derivatives() const
+    { return _n_derivs; }
+
+    //! The n_derivatives() derivatives
+    const libMesh::Real* derivatives() const
+    { return _derivs; }
+
+    libMesh::Real* derivatives()
+    { return _derivs; }
+
+    //! True if this carries no derivative information
+    bool is_constant() const
+    { return _n_derivs == 0; }
+
+    DualNumber& operator+=( const DualNumber& b )
+    {
+      this->add_scaled_derivatives( b, 1.0 );
+      _value += b._value;
+      return *this;
+    }
+
+    DualNumber& operator-=( const DualNumber& b )
+    {
+      this->add_scaled_derivatives( b, -1.0 );
+      _value -= b._value;
+      return *this;
+    }
+
+    DualNumber& operator*=( const DualNumber& b )
+    {
+      if( &b == this )
+        {
+          const DualNumber b_copy(b);
+          return (*this) *= b_copy;
+        }
+
+      // (ab)' = a'b + ab'
+      this->scale_derivatives( b._value );
+      this->add_scaled_derivatives( b, _value );
+      _value *= b._value;
+      return *this;
+    }
+
+    DualNumber& operator/=( const DualNumber& b )
+    {
+      if( &b == this )
+        {
+          const DualNumber b_copy(b);
+          return (*this) /= b_copy;
+        }
+
+      // (a/b)' = (a' - (a/b)b')/b
+      const libMesh::Real inv_b = 1.0/b._value;
+      _value *= inv_b;
+      this->scale_derivatives( inv_b );
+      this->add_scaled_derivatives( b, -_value*inv_b );
+      return *this;
+    }
+
+    //! Value f(a) and derivatives df*a', for an elementary function f of a
+    static DualNumber chain( const DualNumber& a, libMesh::Real f, libMesh::Real df )
+    {
+      DualNumber result(f);
+      result.add_scaled_derivatives( a, df );
+      return result;
+    }
+
+  private:
+
+    void scale_derivatives( libMesh::Real s )
+    {
+      for( unsigned int i = 0; i < _n_derivs; i++ )
+        _derivs[i] *= s;
+    }
+
+    void add_scaled_derivatives( const DualNumber& b, libMesh::Real s )
+    {
+      if( b._n_derivs == 0 )
+        return;
+
+      if( _n_derivs == 0 )
+        {
+          _n_derivs = b._n_derivs;
+          for( unsigned int i = 0; i < _n_derivs; i++ )
+            _derivs[i] = s*b._derivs[i];
+          return;
+        }
+
+      libmesh_assert_equal_to( _n_derivs, b._n_derivs );
+
+      for( unsigned int i = 0; i < _n_derivs; i++ )
+        _derivs[i] += s*b._derivs[i];
+    }
+
+    libMesh::Real _value;
+
+    unsigned int _n_derivs;
+
+    libMesh::Real _derivs[GRINS_DUAL_NUMBER_CAPACITY];
+  };
+
+  inline
+  DualNumber operator+( const DualNumber& a, const DualNumber& b )
+  { DualNumber result(a); result += b; return result; }
+
+  inline
+  DualNumber operator-( const DualNumber& a, const DualNumber& b )
+  { DualNumber result(a); result -= b; return result; }
+
+  inline
+  DualNumber operator*( const DualNumber& a, const DualNumber& b )
+  { DualNumber result(a); result *= b; return result; }
+
+  inline
+  DualNumber operator/( const DualNumber& a, const DualNumber& b )
+  { DualNumber result(a); result /= b; return result; }
+
+  inline
+  DualNumber operator-( const DualNumber& a )
+  { return DualNumber::chain( a, -a.value(), -1.0 ); }
+
+  inline
+  DualNumber operator+( const DualNumber& a )
+  { return a; }
+
+  // Comparisons only look at the value, so that branches in templated
+  // code take the same path for Real and DualNumber
+  inline
+  bool operator<( const DualNumber& a, const DualNumber& b )
+  { return a.value() < b.value(); }
+
+  inline
+  bool operator>( const DualNumber& a, const DualNumber& b )
+  { return a.value() > b.value(); }
+
+  inline
+  bool operator<=( const DualNumber& a, const DualNumber& b )
+  { return a.value() <= b.value(); }
+
+  inline
+  bool operator>=( const DualNumber& a, const DualNumber& b )
+  { return a.value() >= b.value(); }
+
+  inline
+  bool operator==( const DualNumber& a, const DualNumber& b )
+  { return a.value() == b.value(); }
+
+  inline
+  bool operator!=( const DualNumber& a, const DualNumber& b )
+  { return a.value() != b.value(); }
+
+  inline
+  DualNumber sqrt( const DualNumber& a )
+  {
+    const libMesh::Real f = std::sqrt(a.value());
+    return DualNumber::chain( a, f, 0.5/f );
+  }
+
+  inline
+  DualNumber exp( const DualNumber& a )
+  {
+    const libMesh::Real f = std::exp(a.value());
+    return DualNumber::chain( a, f, f );
+  }
+
+  inline
+  DualNumber log( const DualNumber& a )
+  { return DualNumber::chain( a, std::log(a.value()), 1.0/a.value() ); }
+
+  inline
+  DualNumber pow( const DualNumber& a, libMesh::Real b )
+  {
+    const libMesh::Real f = std::pow(a.value(), b);
+    return DualNumber::chain( a, f, b*std::pow(a.value(), b-1.0) );
+  }
+
+  inline
+  DualNumber abs( const DualNumber& a )
+  { return DualNumber::chain( a, std::abs(a.value()), (a.value() < 0.0) ? -1.0 : 1.0 ); }
+
+  //! Value of a Real or DualNumber, e.g. for output or for Real-only helpers
+  inline
+  libMesh::Real raw_value( libMesh::Real a )
+  { return a; }
+
+  inline
+  libMesh::Real raw_value( const DualNumber& a )
+  { return a.value(); }
+
+} // end namespace GRINS
+
+#endif // GRINS_DUAL_NUMBER_H
@@ -0,0 +1,210 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_SCRATCH_WORKSPACE_H
+#define GRINS_SCRATCH_WORKSPACE_H
+
+//C++
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh.h"
+#include "libmesh/vector_value.h" //libMesh::Gradient
+#include "libmesh/tensor_value.h" //libMesh::Tensor
+
+namespace GRINS
+{
+  //! Stack of reusable buffers of type T
+  /*!
+    Buffers are handed out in stack order and are never freed until the
+    pool is destroyed, so once a given call pattern has been run (e.g.
+    assembly on one element), repeating it does not touch the heap.
+    Each time a buffer has to be created or grown beyond its current
+    capacity, the allocation count is incremented.
+   */
+  template<typename T>
+  class ScratchBufferPool
+  {
+  public:
+
+    ScratchBufferPool();
+    ~ScratchBufferPool();
+
+    //! Next buffer on the stack, resized to size with value initialized entries
+    std::vector<T>& acquire( unsigned int size );
+
+    //! Current stack position
+    unsigned int top() const
+    { return _top; }
+
+    //! Hand back all buffers acquired since the stack was at position top
+    void release_to( unsigned int top );
+
+    unsigned int n_allocations() const
+    { return _n_allocations; }
+
+    void reset_allocation_count()
+    { _n_allocations = 0; }
+
+  private:
+
+    // We hand out references to the buffers, so we store pointers
+    // to keep those references valid as the stack grows.
+    std::vector<std::vector<T>*> _buffers;
+
+    unsigned int _top;
+
+    unsigned int _n_allocations;
+
+    // Not copyable
+    ScratchBufferPool( const ScratchBufferPool& );
+    ScratchBufferPool& operator=( const ScratchBufferPool& );
+  };
+
+  //! Per-thread scratch memory for assembly
+  /*!
+    Each AssemblyContext owns one ScratchWorkspace. Physics that need
+    temporary per-element or per-quadrature-point storage (e.g. mass fractions
+    or diffusion coefficients for each species) should request it through a
+    ScratchWorkspace::Scope instead of declaring local std::vectors. The
+    buffers keep their capacity across elements, so after the first element
+    has been assembled, assembly does no heap allocation for scratch storage.
+    This can be checked with n_allocations().
+
+    Buffers acquired through a Scope are only valid for the lifetime of
+    that Scope. Scopes may be nested, e.g. a helper function may open its
+    own Scope while the caller's buffers are still in use.
+   */
+  class ScratchWorkspace
+  {
+  public:
+
+    ScratchWorkspace();
+    ~ScratchWorkspace();
+
+    class Scope
+    {
+    public:
+
+      Scope( ScratchWorkspace& workspace );
+      ~Scope();
+
+      std::vector<libMesh::Real>& real_buffer( unsigned int size )
+      { return _workspace._real_pool.acquire(size); }
+
+      std::vector<libMesh::Gradient>& gradient_buffer( unsigned int size )
+      { return _workspace._gradient_pool.acquire(size); }
+
+      std::vector<libMesh::Tensor>& tensor_buffer( unsigned int size )
+      { return _workspace._tensor_pool.acquire(size); }
+
+      //! Buffer for integers, e.g. dof offsets or indices
+      std::vector<unsigned int>& index_buffer( unsigned int size )
+      { return _workspace._index_pool.acquire(size); }
+
+    private:
+
+      ScratchWorkspace& _workspace;
+
+      unsigned int _real_top;
+      unsigned int _gradient_top;
+      unsigned int _tensor_top;
+      unsigned int _index_top;
+
+      // Not copyable
+      Scope( const Scope& );
+      Scope& operator=( const Scope& );
+    };
+
+    //! Number of buffer creations/reallocations since construction or the last reset
+    unsigned int n_allocations() const;
+
+    void reset_allocation_count();
+
+  private:
+
+    friend class Scope;
+
+    ScratchBufferPool<libMesh::Real> _real_pool;
+    ScratchBufferPool<libMesh::Gradient> _gradient_pool;
+    ScratchBufferPool<libMesh::Tensor> _tensor_pool;
+    ScratchBufferPool<unsigned int> _index_pool;
+
+    // Not copyable
+    ScratchWorkspace( const ScratchWorkspace& );
+    ScratchWorkspace& operator=( const ScratchWorkspace& );
+  };
+
+  template<typename T>
+  inline
+  std::vector<T>& ScratchBufferPool<T>::acquire( unsigned int size )
+  {
+    if( _top == _buffers.size() )
+      {
+        _buffers.push_back( new std::vector<T> );
+        _n_allocations++;
+      }
+
+    std::vector<T>& buffer = *(_buffers[_top]);
+    _top++;
+
+    if( size > buffer.capacity() )
+      _n_allocations++;
+
+    // assign() doesn't reallocate when size fits in the current capacity
+    buffer.assign( size, T() );
+
+    return buffer;
+  }
+
+  template<typename T>
+  inline
+  void ScratchBufferPool<T>::release_to( unsigned int top )
+  {
+    libmesh_assert_less_equal( top, _top );
+    _top = top;
+  }
+
+  inline
+  ScratchWorkspace::Scope::Scope( ScratchWorkspace& workspace )
+    : _workspace(workspace),
+      _real_top(workspace._real_pool.top()),
+      _gradient_top(workspace._gradient_pool.top()),
+      _tensor_top(workspace._tensor_pool.top()),
+      _index_top(workspace._index_pool.top())
+  {}
+
+  inline
+  ScratchWorkspace::Scope::~Scope()
+  {
+    _workspace._real_pool.release_to(_real_top);
+    _workspace._gradient_pool.release_to(_gradient_top);
+    _workspace._tensor_pool.release_to(_tensor_top);
+    _workspace._index_pool.release_to(_index_top);
+  }
+
+} // namespace GRINS
+
+#endif // GRINS_SCRATCH_WORKSPACE_H
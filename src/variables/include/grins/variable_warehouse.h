@@ -72,6 +72,9 @@ namespace GRINS
       template <typename DerivedType>
       static DerivedType& get_variable_subclass( const std::string& var_name );
 
+      //! Number of distinct system variables in all registered FEVariablesBase objects
+      static unsigned int n_vars();
+
       //! Clears the var_map()
       static void clear()
       { var_map().clear(); }
@@ -0,0 +1,142 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_ASYNC_VISUALIZATION_WRITER_H
+#define GRINS_ASYNC_VISUALIZATION_WRITER_H
+
+// libMesh
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+
+// C++
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class EquationSystems;
+  class MeshBase;
+}
+
+namespace GRINS
+{
+  //! Writes visualization files on a background thread
+  /*!
+    stage() gathers the nodal solution of all systems into a staging
+    buffer on the calling thread, since that takes parallel communication,
+    and queues it. A writer thread then serializes queued snapshots
+    on processor 0 while the caller moves on. At most queue_depth snapshots
+    are held at once, stage() blocks when the queue is full.
+
+    The mesh is read from the writer thread, so it must not change while
+    snapshots are pending: call flush() before refining or moving the mesh.
+    Only formats that can be written from a gathered nodal solution on a
+    serial mesh are supported, see supports_format().
+
+    Neither netCDF nor libMesh::perflog are thread safe. Visualization
+    therefore flushes before writing any ExodusII, Nemesis or HDF5 file
+    itself, and doesn't write asynchronously when libMesh performance
+    logging is enabled.
+   */
+  class AsyncVisualizationWriter
+  {
+  public:
+
+    AsyncVisualizationWriter( libMesh::MeshBase& mesh,
+                              unsigned int queue_depth );
+
+    //! Flushes pending snapshots before stopping the writer thread
+    ~AsyncVisualizationWriter();
+
+    //! Whether format can be written asynchronously
+    static bool supports_format( const std::string& format );
+
+    //! Snapshot equation_system and queue it to be written in each of formats
+    void stage( const libMesh::EquationSystems& equation_system,
+                const std::string& filename_prefix,
+                const std::vector<std::string>& formats,
+                libMesh::Real time );
+
+    //! Block until all staged snapshots have been written
+    void flush();
+
+    const libMesh::MeshBase& mesh() const
+    { return _mesh; }
+
+  private:
+
+    struct Snapshot
+    {
+      std::string filename_prefix;
+      std::vector<std::string> formats;
+      libMesh::Real time;
+      std::vector<libMesh::Number> solution;
+      std::vector<std::string> var_names;
+    };
+
+    //! Writer thread main loop
+    void run();
+
+    void write( const Snapshot& snapshot ) const;
+
+    //! Throw on every processor if the writer thread on processor 0 failed
+    /*! error is the writer thread error on processor 0 and ignored
+        elsewhere. Collective. */
+    void check_error( std::string error ) const;
+
+    libMesh::MeshBase& _mesh;
+
+    unsigned int _queue_depth;
+
+    std::deque<Snapshot> _queue;
+
+    //! Whether the writer thread is in the middle of writing a snapshot
+    bool _writing;
+
+    bool _shutdown;
+
+    std::string _error;
+
+    std::mutex _mutex;
+    std::condition_variable _snapshot_queued;
+    std::condition_variable _snapshot_written;
+
+    std::thread _thread;
+  };
+
+} // end namespace GRINS
+
+#endif // LIBMESH_HAVE_CXX11_THREAD
+
+#endif // GRINS_ASYNC_VISUALIZATION_WRITER_H
@@ -35,12 +35,16 @@
 
 // GRINS
 #include "grins/shared_ptr.h"
+#include "grins/async_visualization_writer.h"
+#include "grins/xdmf_io.h"
 
 // libMesh forward declarations
 class GetPot;
 namespace libMesh
 {
   class ParameterVector;
+  class ExodusII_IO;
+  class Nemesis_IO;
 }
 
 namespace GRINS
@@ -101,11 +105,90 @@ namespace GRINS
     void dump_visualization( SharedPtr<libMesh::EquationSystems> equation_system,
 			     const std::string& filename_prefix, const libMesh::Real time );
 
+    //! Wait for pending asynchronous output to be written
+    /*! Must be called before the mesh changes and at the end of a run.
+        Does nothing for synchronous output. */
+    void flush();
+
+    //! Start new time series files, since the current ones can't hold a different mesh
+    /*! Must be called after the mesh is refined or coarsened. Does
+        nothing unless vis-options/output_time_series is set. */
+    void mesh_changed();
+
+    //! Continue the time series in new files after a restart from a checkpoint
+    /*! Skips the series files that already exist, so the output of
+        the interrupted run isn't overwritten. Does nothing unless
+        vis-options/output_time_series is set. Collective. */
+    void restarted( const libMesh::Parallel::Communicator& comm );
+
+    //! Name, without extension, of the index-th time series file
+    std::string series_filename( unsigned int index ) const;
+
+    //! vis-options/vis_output_file_prefix, unless it's been changed
+    const std::string& output_file_prefix() const
+    { return _vis_output_file_prefix; }
+
+    //! Write all further output with the given prefix
+    /*! Must be called before any time series output, whose files
+        are only opened once. */
+    void set_output_file_prefix( const std::string& prefix )
+    { _vis_output_file_prefix = prefix; }
+
   protected:
 
+    void dump_visualization( SharedPtr<libMesh::EquationSystems> equation_system,
+			     const std::string& filename_prefix, const libMesh::Real time,
+                             const std::vector<std::string>& formats );
+
+    //! Append the current solution to the ExodusII, Nemesis or HDF5 time series
+    void append_time_series( SharedPtr<libMesh::EquationSystems> equation_system,
+                             const std::string& format, const libMesh::Real time );
+
+    //! Whether any format already has an index-th time series file
+    bool have_series_file( unsigned int index, unsigned int n_processors ) const;
+
+    //! Wait for the writer thread before writing ExodusII, Nemesis or HDF5 files ourselves
+    void finish_async_netcdf_output();
+
+    //! Make sure the subdirectory in _vis_output_file_prefix exists
+    void create_output_directory( const libMesh::MeshBase& mesh ) const;
+
     // Visualization options
     std::string _vis_output_file_prefix;
     std::vector<std::string> _output_format;
+
+    //! Write supported formats on a background thread, vis-options/async_output
+    bool _async_output;
+
+    //! Maximum number of pending asynchronous snapshots, vis-options/async_queue_depth
+    unsigned int _async_queue_depth;
+
+    //! Rows per HDF5 dataset chunk, vis-options/hdf5_chunk_size
+    unsigned int _hdf5_chunk_size;
+
+    //! gzip level of HDF5 datasets, vis-options/hdf5_compression_level
+    unsigned int _hdf5_compression_level;
+
+    //! Append time steps to a single ExodusII/Nemesis/HDF5 file, vis-options/output_time_series
+    bool _output_time_series;
+
+    //! Writers for the current time series, built on the first time step
+    SharedPtr<libMesh::ExodusII_IO> _exodus_series;
+    SharedPtr<libMesh::Nemesis_IO> _nemesis_series;
+#ifdef GRINS_HAVE_HDF5
+    SharedPtr<XDMFIO> _hdf5_series;
+#endif
+
+    //! Time step index within the current time series files
+    unsigned int _series_step;
+
+    //! Number of time series files started over after mesh changes
+    unsigned int _series_index;
+
+#ifdef LIBMESH_HAVE_CXX11_THREAD
+    //! Built on the first asynchronous output
+    SharedPtr<AsyncVisualizationWriter> _async_writer;
+#endif
   };
 }// namespace GRINS
 #endif // GRINS_VISUALIZATION_H
@@ -0,0 +1,148 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_XDMF_IO_H
+#define GRINS_XDMF_IO_H
+
+#include "grins_config.h"
+
+#ifdef GRINS_HAVE_HDF5
+
+// C++
+#include <string>
+#include <utility>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// HDF5
+#include "hdf5.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class EquationSystems;
+  class MeshBase;
+  class Node;
+}
+
+namespace GRINS
+{
+  //! Writes nodal solutions to HDF5 with an XDMF description
+  /*!
+    All processors write their local nodes and active elements collectively
+    into one HDF5 file (through MPI-IO when HDF5 was built in parallel),
+    so output doesn't serialize through processor 0 or produce a file per
+    processor. Processor 0 then writes the small XDMF file that ParaView
+    or VisIt open.
+
+    The mesh is stored once per file as a mixed topology indexed by node
+    id. Nodal (Lagrange) variables are stored per time step, other
+    variables are skipped. Nodes without dofs of a lower order variable,
+    e.g. the midside nodes of a Taylor-Hood pressure, get values
+    interpolated from an element. Datasets are optionally chunked and
+    compressed. Compression with parallel HDF5 requires HDF5 1.10.2.
+   */
+  class XDMFIO
+  {
+  public:
+
+    XDMFIO( const libMesh::MeshBase& mesh );
+
+    ~XDMFIO();
+
+    //! Rows per chunk of each dataset, 0 for contiguous datasets
+    void set_chunk_size( unsigned int chunk_size )
+    { _chunk_size = chunk_size; }
+
+    //! gzip level from 0 (no compression) to 9, requires chunking
+    void set_compression_level( unsigned int compression_level )
+    { _compression_level = compression_level; }
+
+    //! Write the mesh and solution to filename_prefix.h5 and filename_prefix.xmf
+    void write( const std::string& filename_prefix,
+                const libMesh::EquationSystems& equation_system,
+                libMesh::Real time );
+
+    //! Append a time step to filename_prefix.h5 and filename_prefix.xmf
+    /*! The files are created, including the mesh, on the first call. The
+        mesh must not change between calls. */
+    void append_timestep( const std::string& filename_prefix,
+                          const libMesh::EquationSystems& equation_system,
+                          libMesh::Real time );
+
+  private:
+
+    //! Open filename for collective writes, creating it if requested
+    hid_t open_file( const std::string& filename, bool create ) const;
+
+    void write_mesh( hid_t file );
+
+    void write_fields( hid_t file, const std::string& group_name,
+                       const libMesh::EquationSystems& equation_system );
+
+    //! Write the XDMF description of all time steps so far on processor 0
+    void write_xdmf( const std::string& filename_prefix ) const;
+
+    //! Create a dataset of n_rows x n_cols using the chunking/compression settings
+    hid_t create_dataset( hid_t location, const std::string& name, hid_t type,
+                          hsize_t n_rows, hsize_t n_cols ) const;
+
+    //! Write values, row by row, to the given rows of a dataset
+    /*! rows must be increasing. Each contiguous range of rows is
+        selected as one hyperslab. */
+    void write_rows( hid_t dataset, const std::vector<hsize_t>& rows,
+                     const std::vector<double>& values ) const;
+
+    //! Nodes owned by this processor, sorted by id
+    void sorted_local_nodes( std::vector<const libMesh::Node*>& nodes ) const;
+
+    const libMesh::MeshBase& _mesh;
+
+    unsigned int _chunk_size;
+
+    unsigned int _compression_level;
+
+    //! Collective transfers, if parallel HDF5 is available
+    hid_t _transfer_plist;
+
+    //! Dataset sizes of the mesh written to the current file
+    hsize_t _n_nodes;
+    hsize_t _n_elem;
+    hsize_t _topology_size;
+
+    //! Names of the nodal variables in each time step
+    std::vector<std::string> _field_names;
+
+    //! HDF5 group and time of each time step in the current file
+    std::vector<std::pair<std::string, libMesh::Real> > _timesteps;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_HAVE_HDF5
+
+#endif // GRINS_XDMF_IO_H
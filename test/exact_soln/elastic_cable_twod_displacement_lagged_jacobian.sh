@@ -0,0 +1,22 @@
+#!/bin/bash
+
+set -e
+set -o pipefail
+
+INPUT="${GRINS_TEST_INPUT_DIR}/elastic_cable_twod_displacement_lagged_jacobian.in"
+TESTDATA="./elastic_cable_twod_displacement_lagged_jacobian.xdr"
+LOGFILE="./elastic_cable_twod_displacement_lagged_jacobian.log"
+
+# First run the case with grins
+${LIBMESH_RUN:-} ${GRINS_BUILDSRC_DIR}/grins $INPUT | tee $LOGFILE
+
+# Make sure the lagged matrix was actually reused and then refreshed,
+# either because convergence slowed down or because a step was retried
+grep -q "Reusing matrix" $LOGFILE
+grep -q -e "Slow convergence, reassembling" -e "increased the residual, reassembling" $LOGFILE
+
+# Now run the test part to make sure we're getting the correct thing
+${LIBMESH_RUN:-} ${GRINS_TEST_DIR}/generic_exact_solution_testing_app input=$INPUT vars='Ux Uy' norms='L2' tol='1.0e-10' Ux_L2_error='1.0e-10' Uy_L2_error='1.0e-10' Ux_exact_soln='0.1*x/8' Uy_exact_soln='0.2*x/8' test_data=$TESTDATA
+
+# Now remove the test turds
+rm $TESTDATA $LOGFILE
@@ -0,0 +1,26 @@
+#!/bin/bash
+
+set -e
+set -o pipefail
+
+INPUT="${GRINS_TEST_INPUT_DIR}/poiseuille_flow_pseudo_transient_input.in"
+TESTDATA="./ns_poiseuille_flow_pseudo_transient.xda"
+LOGFILE="./ns_poiseuille_flow_pseudo_transient.log"
+
+# First run the case with grins
+${LIBMESH_RUN:-} ${GRINS_BUILDSRC_DIR}/grins $INPUT | tee $LOGFILE
+
+# Make sure we actually took pseudo time steps before switching to
+# Newton's method, rather than solving from the start
+N_STEPS=$(grep "Switching to Newton's method after" $LOGFILE | sed -e 's/.* after \([0-9]*\) pseudo time steps.*/\1/')
+
+rm $LOGFILE
+
+echo "Pseudo time steps: $N_STEPS"
+test "$N_STEPS" -ge 1
+
+# Now run the test part to make sure we're getting the correct thing
+${LIBMESH_RUN:-} ${GRINS_TEST_DIR}/generic_exact_solution_testing_app input=$INPUT vars='u v p' norms='L2' tol='1.0e-10' u_L2_error='1.0e-10' v_L2_error='1.0e-10' p_L2_error='1.0e-10' u_exact_soln='4*y*(1-y)' v_exact_soln='0.0' p_exact_soln='120.0+(80.0-120.0)/5.0*x' test_data=$TESTDATA
+
+# Now remove the test turd
+rm $TESTDATA
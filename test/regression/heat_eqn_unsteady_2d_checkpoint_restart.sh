@@ -0,0 +1,25 @@
+#!/bin/bash
+
+set -e
+
+PROG="${GRINS_TEST_DIR}/generic_solution_regression"
+
+INPUT_1="${GRINS_TEST_INPUT_DIR}/heat_eqn_unsteady_2d_checkpoint_restart_pt1.in"
+INPUT_2="${GRINS_TEST_INPUT_DIR}/heat_eqn_unsteady_2d_checkpoint_restart_pt2.in"
+
+# Final solution of the uninterrupted run
+DATA="./heat_eqn_unsteady_2d_checkpoint_restart_pt1.24.xdr"
+
+TESTDATA_NOTUSED="./heat_eqn_unsteady_2d_checkpoint_restart_pt1.xdr"
+CHECKPOINTS="./heat_eqn_unsteady_2d_checkpoint.12 ./heat_eqn_unsteady_2d_checkpoint.24 ./heat_eqn_unsteady_2d_checkpoint_mesh.0"
+
+# First run all the time steps, checkpointing halfway through
+${LIBMESH_RUN:-} ${GRINS_BUILDSRC_DIR}/grins $INPUT_1
+
+# Then restart from the halfway checkpoint and make sure we end up
+# with the same solution
+${LIBMESH_RUN:-} $PROG input=$INPUT_2 soln-data=$DATA vars='u' norms='L2 H1' tol='1.0e-10'
+
+# Now remove the test turds
+rm $DATA $TESTDATA_NOTUSED
+rm -r $CHECKPOINTS
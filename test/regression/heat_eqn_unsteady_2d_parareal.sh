@@ -0,0 +1,41 @@
+#!/bin/bash
+
+set -e
+set -o pipefail
+
+# Each of the 2 time slices needs the same number of processors
+NP=$(echo "${LIBMESH_RUN:-}" | sed -n -e 's/.*-np* *\([0-9][0-9]*\).*/\1/p')
+
+if [ -z "$NP" ] || [ $((NP % 2)) -ne 0 ]; then
+   exit 77
+fi
+
+PROG="${GRINS_TEST_DIR}/generic_solution_regression"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/heat_eqn_unsteady_2d_parareal.in"
+SERIAL_INPUT="./heat_eqn_unsteady_2d_parareal_serial.in"
+LOGFILE="./heat_eqn_unsteady_2d_parareal.log"
+
+# Final solution, from the last time slice
+DATA="./heat_eqn_unsteady_2d_parareal_slice1.23.xdr"
+TESTDATA_NOTUSED="./heat_eqn_unsteady_2d_parareal_slice0.11.xdr"
+
+${LIBMESH_RUN:-} ${GRINS_BUILDSRC_DIR}/grins $INPUT | tee $LOGFILE
+
+# With 2 slices, the second iteration already starts every slice from
+# the fine solution
+ITERATIONS=$(grep "Parareal with 2 time slices" $LOGFILE | sed -e 's/.* after \([0-9]*\) iterations.*/\1/')
+
+rm $LOGFILE
+
+echo "Parareal iterations: $ITERATIONS"
+test "$ITERATIONS" -le 2
+
+# The same time steps in one go should end up with the same solution
+sed -e '/Parareal\|n_time_slices\|coarse_timesteps_per_slice/d' \
+    -e "s/output_vis = 'true'/output_vis = 'false'/" $INPUT > $SERIAL_INPUT
+
+${LIBMESH_RUN:-} $PROG input=$SERIAL_INPUT soln-data=$DATA vars='u' norms='L2 H1' tol='1.0e-8'
+
+# Now remove the test turds
+rm $SERIAL_INPUT $DATA $TESTDATA_NOTUSED
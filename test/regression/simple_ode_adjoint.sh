@@ -0,0 +1,47 @@
+#!/bin/bash
+
+set -e
+set -o pipefail
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/simple_ode_adjoint.in"
+LOGFILE="./simple_ode_adjoint.log"
+
+# Central finite difference step in k
+DK=1.0e-4
+
+# FIXME: In theory we should be able to solve a scalar problem on
+# multiple processors, where ranks 1+ just twiddle their thumbs.
+# In practice we get libMesh errors.
+#${LIBMESH_RUN:-} $PROG $INPUT
+$PROG $INPUT | tee $LOGFILE
+
+ADJOINT=$(grep "^dq0/dp0 = " $LOGFILE | sed -e 's/dq0\/dp0 = //')
+
+# The QoI of the same run with k perturbed, without the adjoint solve
+perturbed_qoi()
+{
+  sed -e "s/k:=1;/k:=$1;/" -e "/adjoint_sensitivity_parameters/d" $INPUT > ./simple_ode_adjoint_fd.in
+
+  $PROG ./simple_ode_adjoint_fd.in > $LOGFILE
+
+  grep "^parsed_interior = " $LOGFILE | sed -e 's/parsed_interior = //'
+
+  rm ./simple_ode_adjoint_fd.in
+}
+
+QOI_PLUS=$(perturbed_qoi $(awk -v dk=$DK 'BEGIN { print 1+dk }'))
+QOI_MINUS=$(perturbed_qoi $(awk -v dk=$DK 'BEGIN { print 1-dk }'))
+
+rm $LOGFILE
+rm -rf ./simple_ode_adjoint_snapshots
+
+# The QoI is the sum of u over the time steps, weighted by deltat, and
+# the adjoint sensitivity should match its finite difference, even
+# though most forward states had to be recomputed from the snapshots.
+awk -v adjoint="$ADJOINT" -v plus="$QOI_PLUS" -v minus="$QOI_MINUS" -v dk=$DK -v tol=1.0e-4 'BEGIN {
+  fd = (plus - minus)/(2*dk);
+  err = (adjoint - fd)/fd; if (err < 0) err = -err;
+  print "Adjoint dq/dk = " adjoint ", finite difference dq/dk = " fd ", relative error = " err;
+  exit (err > tol) }'
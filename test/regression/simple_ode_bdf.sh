@@ -0,0 +1,27 @@
+#!/bin/bash
+
+set -e
+set -o pipefail
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/simple_ode_bdf.in"
+LOGFILE="./simple_ode_bdf.log"
+
+# FIXME: In theory we should be able to solve a scalar problem on
+# multiple processors, where ranks 1+ just twiddle their thumbs.
+# In practice we get libMesh errors.
+#${LIBMESH_RUN:-} $PROG $INPUT
+$PROG $INPUT | tee $LOGFILE
+
+# u' = u with u(0) = 1. The startup steps at lower order leave about
+# 1% error at dt = 0.1, staying at BDF2 would be off by 4%.
+TIME=$(grep "Ending time stepping" $LOGFILE | sed -e 's/.*t = \([^,]*\),.*/\1/')
+U=$(grep "^u = {" $LOGFILE | tail -n 1 | sed -e 's/u = {\(.*\)}/\1/')
+
+rm $LOGFILE
+
+awk -v u="$U" -v t="$TIME" -v tol=0.025 'BEGIN {
+  err = u/exp(t) - 1; if (err < 0) err = -err;
+  print "Relative error in u(" t ") = " err;
+  exit (err > tol) }'
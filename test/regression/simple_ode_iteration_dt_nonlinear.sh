@@ -0,0 +1,28 @@
+#!/bin/bash
+
+set -e
+set -o pipefail
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/simple_ode_iteration_dt_nonlinear.in"
+LOGFILE="./simple_ode_iteration_dt_nonlinear.log"
+
+# FIXME: In theory we should be able to solve a scalar problem on
+# multiple processors, where ranks 1+ just twiddle their thumbs.
+# In practice we get libMesh errors.
+#${LIBMESH_RUN:-} $PROG $INPUT
+$PROG $INPUT | tee $LOGFILE
+
+# u' = u^2 with u(0) = 1. The first ESDIRK stage equation has no
+# solution for the initial dt = 1, so the controller has to reject at
+# least that step instead of aborting, and then accept every time step.
+ACCEPTED=$(grep "Time steps accepted" $LOGFILE | sed -e 's/.*accepted: \([0-9]*\),.*/\1/')
+REJECTED=$(grep "Time steps accepted" $LOGFILE | sed -e 's/.*rejected: \([0-9]*\).*/\1/')
+
+rm $LOGFILE
+
+echo "Accepted $ACCEPTED, rejected $REJECTED time steps"
+
+test "$ACCEPTED" -eq 8
+test "$REJECTED" -ge 1
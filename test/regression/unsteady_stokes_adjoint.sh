@@ -0,0 +1,44 @@
+#!/bin/bash
+
+set -e
+set -o pipefail
+
+PROG="${GRINS_BUILDSRC_DIR}/grins"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/unsteady_stokes_adjoint.in"
+LOGFILE="./unsteady_stokes_adjoint.log"
+
+# Viscosity and its central finite difference step
+MU=0.5
+DMU=1.0e-4
+
+${LIBMESH_RUN:-} $PROG $INPUT | tee $LOGFILE
+
+ADJOINT=$(grep "^dq0/dp0 = " $LOGFILE | sed -e 's/dq0\/dp0 = //')
+
+# The QoI of the same run with the viscosity perturbed, without the adjoint solve
+perturbed_qoi()
+{
+  sed -e "s/value = '$MU'/value = '$1'/" -e "/adjoint_sensitivity_parameters/d" $INPUT > ./unsteady_stokes_adjoint_fd.in
+
+  ${LIBMESH_RUN:-} $PROG ./unsteady_stokes_adjoint_fd.in > $LOGFILE
+
+  grep "^parsed_interior = " $LOGFILE | sed -e 's/parsed_interior = //'
+
+  rm ./unsteady_stokes_adjoint_fd.in
+}
+
+QOI_PLUS=$(perturbed_qoi $(awk -v mu=$MU -v dmu=$DMU 'BEGIN { print mu+dmu }'))
+QOI_MINUS=$(perturbed_qoi $(awk -v mu=$MU -v dmu=$DMU 'BEGIN { print mu-dmu }'))
+
+rm $LOGFILE
+
+# The pressure is a constraint variable and the velocity has
+# constrained dofs on the boundary. Neither may throw off the coupling
+# between time steps, so the adjoint sensitivity of the time integrated
+# QoI should match its finite difference.
+awk -v adjoint="$ADJOINT" -v plus="$QOI_PLUS" -v minus="$QOI_MINUS" -v dmu=$DMU -v tol=1.0e-4 'BEGIN {
+  fd = (plus - minus)/(2*dmu);
+  err = (adjoint - fd)/fd; if (err < 0) err = -err;
+  print "Adjoint dq/dmu = " adjoint ", finite difference dq/dmu = " fd ", relative error = " err;
+  exit (err > tol) }'